@@ -16,6 +16,7 @@
 
 #include "../core/logging.h"
 #include "../formula/model/ran/RealAlgebraicNumber.h"
+#include "../formula/model/ran/RealAlgebraicNumberComparison.h"
 
 #include "CADSettings.h"
 
@@ -25,7 +26,17 @@ namespace cad {
 template<typename Number>
 class SampleSet {
 public:
-	typedef typename std::set<RealAlgebraicNumber<Number>>::iterator Iterator;
+	/**
+	 * A functor compatible to std::less<RealAlgebraicNumber<Number>> that compares two samples by their value.
+	 * Uses carl::compare(), which decides most comparisons without refining the isolating intervals.
+	 */
+	struct ValueComparator {
+		bool operator()(const RealAlgebraicNumber<Number>& lhs, const RealAlgebraicNumber<Number>& rhs) const {
+			return carl::compare(lhs, rhs) < 0;
+		}
+	};
+	typedef std::set<RealAlgebraicNumber<Number>, ValueComparator> Samples;
+	typedef typename Samples::iterator Iterator;
 	typedef std::unordered_map<RealAlgebraicNumber<Number>, RealAlgebraicNumber<Number>> SampleSimplification;
 	/**
 	 * A functor compatible to std::less<RealAlgebraicNumber<Number>> that compares two samples according to a given order.
@@ -130,7 +141,7 @@ public:
 	};
 	
 	/// Contains all samples in the order of their value.
-	std::set<RealAlgebraicNumber<Number>> mSamples;
+	Samples mSamples;
 
 	SampleComparator mComp;
 	std::vector<RealAlgebraicNumber<Number>> mHeap;
@@ -174,7 +185,7 @@ public:
 	 * Retrieves the set of samples stored.
      * @return Sample set.
      */
-	const std::set<RealAlgebraicNumber<Number>>& samples() const {
+	const Samples& samples() const {
 		return this->mSamples;
 	}
 
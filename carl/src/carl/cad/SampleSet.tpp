@@ -46,14 +46,14 @@ bool SampleSet<Number>::SampleComparator::operator()(const RealAlgebraicNumber<N
 			CHECK(compareRoot(lhs, rhs));
 			break;
 		case SampleOrdering::Value:
-			return carl::less<RealAlgebraicNumber<Number>>()(lhs, rhs);
+			return ValueComparator()(lhs, rhs);
 			break;
 		default:
 			CARL_LOG_FATAL("carl.cad.sampleset", "Ordering " << mOrdering << " was not implemented.");
 			assert(false);
 			return false;
 	}
-	return carl::less<RealAlgebraicNumber<Number>>()(lhs, rhs);
+	return ValueComparator()(lhs, rhs);
 }
 
 template<typename Number>
@@ -169,7 +169,7 @@ bool SampleSet<Number>::isConsistent() const {
 	CARL_LOG_TRACE("carl.cad.sampleset", this << " " << __func__ << "()");
 	CARL_LOG_TRACE("carl.cad.sampleset", "samples: " << mSamples);
 	CARL_LOG_TRACE("carl.cad.sampleset", "heap:    " << mHeap);
-	std::set<RealAlgebraicNumber<Number>> queue(mHeap.begin(), mHeap.end());
+	Samples queue(mHeap.begin(), mHeap.end());
 	for (auto n: this->mSamples) {
 		auto it = queue.find(n);
 		if (it == queue.end()) {
@@ -3,7 +3,7 @@
  */ 
 #pragma once
 
-#define CARL_BUILD_
+#define CARL_BUILD_Release
 /* #undef LOGGING */
 /* #undef LOGGING_CARL */
 /* #undef LOGGING_DISABLE_INEFFICIENT */
@@ -0,0 +1,124 @@
+/**
+ * @file:   RealAlgebraicNumberComparison.h
+ *
+ * Comparison of real algebraic numbers, which tries cheap tests before refining the isolating intervals.
+ */
+
+#pragma once
+
+#include "../../../numbers/numbers.h"
+#include "RealAlgebraicNumber.h"
+
+namespace carl {
+
+	/// The tests compare() uses to order two real algebraic numbers, from the cheapest to the most expensive one.
+	enum class RANComparisonTier {
+		/// Both numbers were numeric.
+		Numeric,
+		/// The double approximations of the isolating intervals were separated.
+		Approximation,
+		/// The isolating intervals were separated, possibly after a few bisections.
+		Interval,
+		/// An exact comparison was necessary.
+		Exact
+	};
+
+	namespace ran_comparison {
+		/// Number of bisections of the isolating intervals before falling back to the exact comparison.
+		static constexpr std::size_t maxRefinements = 4;
+
+		template<typename Number>
+		inline const Number& lower(const RealAlgebraicNumber<Number>& r) {
+			return r.isNumeric() ? r.value() : r.lower();
+		}
+		template<typename Number>
+		inline const Number& upper(const RealAlgebraicNumber<Number>& r) {
+			return r.isNumeric() ? r.value() : r.upper();
+		}
+		template<typename Number>
+		inline int compare(const Number& lhs, const Number& rhs) {
+			if (lhs < rhs) return -1;
+			if (rhs < lhs) return 1;
+			return 0;
+		}
+		/// Compares the (open) isolating intervals, returns 0 if they overlap.
+		template<typename Number>
+		inline int compareBounds(const RealAlgebraicNumber<Number>& lhs, const RealAlgebraicNumber<Number>& rhs) {
+			if (lhs.isNumeric() && rhs.isNumeric()) return compare(lhs.value(), rhs.value());
+			if (upper(lhs) <= lower(rhs)) return -1;
+			if (upper(rhs) <= lower(lhs)) return 1;
+			return 0;
+		}
+		/// Compares double approximations of the isolating intervals, returns 0 if they overlap.
+		template<typename Number>
+		inline int compareApproximations(const RealAlgebraicNumber<Number>& lhs, const RealAlgebraicNumber<Number>& rhs) {
+			// The conversion to double is monotone, hence strict inequalities carry over to the exact bounds.
+			if (carl::toDouble(upper(lhs)) < carl::toDouble(lower(rhs))) return -1;
+			if (carl::toDouble(upper(rhs)) < carl::toDouble(lower(lhs))) return 1;
+			return 0;
+		}
+	}
+
+	/**
+	 * Compares two real algebraic numbers and returns -1, 0 or 1 if lhs is smaller, equal or larger than rhs.
+	 * The comparison is decided by the cheapest of the following tiers that succeeds:
+	 * - exact comparison of numeric values,
+	 * - comparison of double approximations of the isolating intervals,
+	 * - comparison of the isolating intervals after at most ran_comparison::maxRefinements bisections,
+	 * - exact check for equality and refinement until the intervals are separated.
+	 * All refinements are stored in the isolating intervals, which are shared by all copies of a number.
+	 * @param lhs First number.
+	 * @param rhs Second number.
+	 * @param tier Is set to the tier which decided the comparison.
+	 * @return The comparison result.
+	 */
+	template<typename Number>
+	int compare(const RealAlgebraicNumber<Number>& lhs, const RealAlgebraicNumber<Number>& rhs, RANComparisonTier& tier) {
+		using namespace ran_comparison;
+		if (lhs.isThom() || rhs.isThom()) {
+			tier = RANComparisonTier::Exact;
+			if (lhs.equal(rhs)) return 0;
+			return lhs.less(rhs) ? -1 : 1;
+		}
+		if (lhs.isNumeric() && rhs.isNumeric()) {
+			tier = RANComparisonTier::Numeric;
+			return compare(lhs.value(), rhs.value());
+		}
+		int res = compareApproximations(lhs, rhs);
+		if (res != 0) {
+			tier = RANComparisonTier::Approximation;
+			return res;
+		}
+		res = compareBounds(lhs, rhs);
+		// Numbers with the same defining polynomial are likely to be equal, such that bisection does not help.
+		bool samePolynomial = lhs.isInterval() && rhs.isInterval() && lhs.getIRPolynomial() == rhs.getIRPolynomial();
+		for (std::size_t i = 0; res == 0 && !samePolynomial && i < maxRefinements; i++) {
+			lhs.refine();
+			rhs.refine();
+			res = compareBounds(lhs, rhs);
+		}
+		if (res != 0) {
+			tier = RANComparisonTier::Interval;
+			return res;
+		}
+		tier = RANComparisonTier::Exact;
+		if (lhs.equal(rhs)) return 0;
+		// The numbers differ, hence bisection eventually separates the intervals.
+		res = compareBounds(lhs, rhs);
+		while (res == 0) {
+			lhs.refine();
+			rhs.refine();
+			res = compareBounds(lhs, rhs);
+		}
+		return res;
+	}
+
+	/**
+	 * Compares two real algebraic numbers like compare(lhs, rhs, tier), but does not report the deciding tier.
+	 */
+	template<typename Number>
+	inline int compare(const RealAlgebraicNumber<Number>& lhs, const RealAlgebraicNumber<Number>& rhs) {
+		RANComparisonTier tier;
+		return compare(lhs, rhs, tier);
+	}
+}
@@ -44,9 +44,26 @@ class AbstractGBProcedure
 template<typename Polynomial, template<typename, template<typename> class > class Procedure, template<typename> class AddingPolynomialPolicy>
 class GBProcedure : private Procedure<Polynomial, AddingPolynomialPolicy>, public AbstractGBProcedure<Polynomial>
 {
+public:
+	/**
+	 * The state of a GBProcedure as taken by snapshot() and reinstated by restore().
+	 * The ideal is shared and never modified afterwards, hence taking a snapshot does not copy the basis.
+	 */
+	struct Snapshot
+	{
+		/// The ideal represented by the elements of the Groebner basis.
+		std::shared_ptr<Ideal<Polynomial>> mGb;
+		/// The polynomials which were scheduled for adding.
+		std::list<Polynomial> mInputScheduled;
+		/// The number of input polynomials.
+		size_t mNrOrigGenerators;
+	};
+
 private:
 	/// The ideal represented by the current elements of the Groebner basis.
 	std::shared_ptr<Ideal<Polynomial>> mGb;
+	/// Whether mGb is shared with a snapshot, in which case it is copied before it is modified.
+	bool mGbShared;
 	/// The polynomials which are added during the next call for calculate.
 	std::list<Polynomial> mInputScheduled;
 	/// The input polynomials
@@ -59,6 +76,7 @@ public:
 	GBProcedure():
 		Procedure<Polynomial, AddingPolynomialPolicy>(),
 		mGb(new Ideal<Polynomial>),
+		mGbShared(false),
 		mInputScheduled(),
 		mOrigGenerators(),
 		mOrigGeneratorsIndices()
@@ -70,6 +88,7 @@ public:
 	GBProcedure(const GBProcedure& old):
 	    Procedure<Polynomial, AddingPolynomialPolicy>(old),
 		mGb(new Ideal<Polynomial>(*old.mGb)),
+		mGbShared(false),
 		mInputScheduled(old.mInputScheduled),
 		mOrigGenerators(old.mOrigGenerators),
 		mOrigGeneratorsIndices(old.mOrigGeneratorsIndices)
@@ -83,6 +102,7 @@ public:
 	{
 		if(this == &rhs) return *this;
 		mGb.reset(new Ideal<Polynomial>(*rhs.mGb));
+		mGbShared = false;
 		mInputScheduled = rhs.mInputScheduled;
 		mOrigGenerators = rhs.mOrigGenerators;
 		mOrigGeneratorsIndices = rhs.mOrigGeneratorsIndices;
@@ -91,6 +111,36 @@ public:
 		return *this;
 	}
 	
+	/**
+	 * Saves the current state without copying the Groebner basis.
+	 * Only the polynomials scheduled for adding, which have been added since the last call of calculate, are copied.
+	 * @return The snapshot, which can be passed to restore().
+	 */
+	Snapshot snapshot()
+	{
+		mGbShared = true;
+		return Snapshot{mGb, mInputScheduled, mOrigGenerators.size()};
+	}
+
+	/**
+	 * Reinstates a snapshot which was taken from this procedure.
+	 * The snapshots have to be restored in stack order, that is, all input polynomials added since the snapshot are dropped.
+	 * Critical pairs are only pending within calculate, hence they are not part of the snapshot.
+	 * @param s The snapshot.
+	 */
+	void restore(const Snapshot& s)
+	{
+		mGb = s.mGb;
+		mGbShared = true;
+		mInputScheduled = s.mInputScheduled;
+		if(s.mNrOrigGenerators < mOrigGenerators.size())
+		{
+			mOrigGenerators.resize(s.mNrOrigGenerators);
+		}
+		Procedure<Polynomial, AddingPolynomialPolicy>::setIdeal(mGb);
+		Procedure<Polynomial, AddingPolynomialPolicy>::resetCriticalPairs();
+	}
+
 	/**
 	 * Check whether a polynomial is scheduled to be added to the Groebner basis.
      * @return whether the input is empty.
@@ -176,6 +226,7 @@ public:
 	void reset() 
 	{
 		mGb.reset(new Ideal<Polynomial>());
+		mGbShared = false;
 		Procedure<Polynomial, AddingPolynomialPolicy>::setIdeal(mGb);
 	}
 	
@@ -198,6 +249,13 @@ public:
 		{
 			return;
 		}
+		if(mGbShared)
+		{
+			// The procedure modifies the ideal, which still belongs to a snapshot.
+			mGb.reset(new Ideal<Polynomial>(*mGb));
+			mGbShared = false;
+			Procedure<Polynomial, AddingPolynomialPolicy>::setIdeal(mGb);
+		}
 		// Use procedure
 		Procedure<Polynomial, AddingPolynomialPolicy>::calculate(mInputScheduled);
 		// remove the just added polynomials from the set of input polynomials
@@ -121,6 +121,13 @@ public:
 	{
 		pCritPairs = criticalPairs;
 	}
+	/**
+	 * Discards the pending critical pairs, e.g. after the ideal has been replaced.
+	 */
+	void resetCriticalPairs()
+	{
+		pCritPairs.reset(new CritPairs());
+	}
 
 	//std::list<std::pair<BitVector, BitVector> > reduceInput();
 
@@ -0,0 +1,87 @@
+/**
+ * @file   F4.h
+ * @ingroup gb
+ */
+
+#pragma once
+
+#include "../gb-buchberger/Buchberger.h"
+#include "../../util/BitVector.h"
+
+#include <map>
+#include <set>
+#include <vector>
+
+namespace carl
+{
+
+/**
+ * Matrix based Groebner basis computation in the style of Faugere's F4.
+ *
+ * Instead of reducing one S-polynomial after another, all critical pairs of minimal degree are reduced at once:
+ * the symbolic preprocessing collects the multiples of basis elements needed to reduce them,
+ * the resulting sparse Macaulay matrix is brought into row echelon form and
+ * the rows whose leading monomials are not leading monomials of the matrix are added to the basis.
+ *
+ * The critical pairs and the criteria to discard them are shared with the Buchberger procedure.
+ * The matrix is reduced over the rationals, the reasons of a row are the union of the reasons of all rows used to reduce it.
+ * @ingroup gb
+ */
+template<typename Polynomial, template<typename> class AddingPolicy>
+class F4 : public Buchberger<Polynomial, AddingPolicy>
+{
+	using Super = Buchberger<Polynomial, AddingPolicy>;
+	using Coeff = typename Polynomial::CoeffType;
+	using Order = typename Polynomial::OrderedBy;
+
+	struct MonomialLess
+	{
+		bool operator()(const Monomial::Arg& lhs, const Monomial::Arg& rhs) const
+		{
+			return Order::less(lhs, rhs);
+		}
+	};
+	struct RowKeyLess
+	{
+		bool operator()(const std::pair<std::size_t, Monomial::Arg>& lhs, const std::pair<std::size_t, Monomial::Arg>& rhs) const
+		{
+			if(lhs.first != rhs.first) return lhs.first < rhs.first;
+			return Order::less(lhs.second, rhs.second);
+		}
+	};
+
+	/// A sparse row of the Macaulay matrix, the entries are sorted by their columns.
+	struct Row
+	{
+		std::vector<std::pair<std::size_t, Coeff>> mEntries;
+		BitVector mReasons;
+		/// Whether the row is a multiple of a basis element added by the symbolic preprocessing.
+		bool mIsReducer;
+	};
+
+public:
+	F4() = default;
+	F4(const F4& rhs) = default;
+	~F4() override = default;
+
+	void calculate(const std::list<Polynomial>& scheduledForAdding);
+
+protected:
+	/**
+	 * Takes all critical pairs whose lcm has the minimal total degree.
+	 */
+	std::vector<SPolPair> selectPairs();
+	/**
+	 * Reduces the given critical pairs simultaneously.
+	 * @return The new, normalized basis elements, sorted by their leading terms.
+	 */
+	std::vector<Polynomial> reducePairs(const std::vector<SPolPair>& pairs);
+	/**
+	 * Sets row to row + factor * pivot. The columns of pivot must not be smaller than the column of the first entry of pivot.
+	 */
+	static void addMultiple(std::vector<std::pair<std::size_t, Coeff>>& row, std::size_t position, const Coeff& factor, const std::vector<std::pair<std::size_t, Coeff>>& pivot);
+};
+
+}
+
+#include "F4.tpp"
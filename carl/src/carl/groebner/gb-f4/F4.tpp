@@ -0,0 +1,270 @@
+/**
+ * @file F4.tpp
+ * @ingroup gb
+ */
+#pragma once
+#include "F4.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace carl
+{
+
+template<class Polynomial, template<typename> class AddingPolicy>
+void F4<Polynomial, AddingPolicy>::calculate(const std::list<Polynomial>& scheduledForAdding)
+{
+	CARL_LOG_INFO("carl.gb.f4", "Calculate gb");
+	for(std::size_t i = 0; i < this->pGb->getGenerators().size(); ++i)
+	{
+		this->mGbElementsIndices.push_back(i);
+	}
+
+	bool foundGB = false;
+	for(const Polynomial& newPol : scheduledForAdding)
+	{
+		if(this->addToGb(newPol))
+		{
+			CARL_LOG_INFO("carl.gb.f4", "Added a constant polynomial.");
+			foundGB = true;
+			break;
+		}
+	}
+
+	while(!foundGB && !this->pCritPairs->empty())
+	{
+		std::vector<SPolPair> pairs = selectPairs();
+		CARL_LOG_DEBUG("carl.gb.f4", "Reducing " << pairs.size() << " critical pairs of degree " << pairs.front().mLcm->tdeg());
+		for(const Polynomial& newPol : reducePairs(pairs))
+		{
+			CARL_LOG_DEBUG("carl.gb.f4", "New basis element: " << newPol);
+			if(newPol.isConstant())
+			{
+				this->pGb->clear();
+				this->pGb->addGenerator(newPol);
+				foundGB = true;
+				break;
+			}
+			if(this->addToGb(newPol))
+			{
+				foundGB = true;
+				break;
+			}
+		}
+	}
+	this->mGbElementsIndices.clear();
+}
+
+template<class Polynomial, template<typename> class AddingPolicy>
+std::vector<SPolPair> F4<Polynomial, AddingPolicy>::selectPairs()
+{
+	assert(!this->pCritPairs->empty());
+	std::vector<SPolPair> pairs;
+	pairs.push_back(this->pCritPairs->pop());
+	exponent degree = pairs.front().mLcm->tdeg();
+	while(!this->pCritPairs->empty())
+	{
+		SPolPair next = this->pCritPairs->pop();
+		if(next.mLcm->tdeg() > degree)
+		{
+			// The pairs are popped by increasing lcm, hence the remaining pairs have a larger degree as well.
+			this->pCritPairs->push({next});
+			break;
+		}
+		pairs.push_back(next);
+	}
+	return pairs;
+}
+
+template<class Polynomial, template<typename> class AddingPolicy>
+std::vector<Polynomial> F4<Polynomial, AddingPolicy>::reducePairs(const std::vector<SPolPair>& pairs)
+{
+	const std::vector<Polynomial>& generators = this->pGb->getGenerators();
+
+	// The rows as multiples factor * generators[index], without duplicates.
+	std::vector<std::pair<std::size_t, Monomial::Arg>> rowSources;
+	std::vector<bool> rowIsReducer;
+	std::set<std::pair<std::size_t, Monomial::Arg>, RowKeyLess> knownRows;
+	// All monomials of the rows, the value is whether a reducer for it has been searched for.
+	std::map<Monomial::Arg, bool, MonomialLess> monomials;
+	std::vector<Monomial::Arg> todo;
+
+	auto addRow = [&](std::size_t index, const Monomial::Arg& multiple, bool isReducer)
+	{
+		const Monomial::Arg& lm = generators[index].lmon();
+		Monomial::Arg factor;
+		if(multiple->tdeg() != lm->tdeg())
+		{
+			bool divided = multiple->divide(lm, factor);
+			assert(divided);
+			(void)divided;
+		}
+		if(!knownRows.emplace(index, factor).second) return;
+		rowSources.emplace_back(index, factor);
+		rowIsReducer.push_back(isReducer);
+		for(const auto& term : generators[index])
+		{
+			Monomial::Arg m = term.monomial() * factor;
+			if(monomials.emplace(m, false).second)
+			{
+				todo.push_back(m);
+			}
+		}
+	};
+
+	for(const SPolPair& pair : pairs)
+	{
+		// The leading monomials of the pairs are reduced by the other row of the pair.
+		monomials[pair.mLcm] = true;
+		addRow(pair.mP1, pair.mLcm, false);
+		addRow(pair.mP2, pair.mLcm, false);
+	}
+
+	// Symbolic preprocessing: add a reducer for every monomial that is divisible by a leading monomial of the basis.
+	while(!todo.empty())
+	{
+		Monomial::Arg m = todo.back();
+		todo.pop_back();
+		bool& searched = monomials[m];
+		if(searched || !m) continue;
+		searched = true;
+		for(std::size_t index : this->mGbElementsIndices)
+		{
+			if(m->divisible(generators[index].lmon()))
+			{
+				addRow(index, m, true);
+				break;
+			}
+		}
+	}
+
+	// Assign the columns, the largest monomial gets the first column.
+	std::vector<Monomial::Arg> columnMonomials;
+	std::map<Monomial::Arg, std::size_t, MonomialLess> columns;
+	for(auto it = monomials.rbegin(); it != monomials.rend(); ++it)
+	{
+		columns.emplace(it->first, columnMonomials.size());
+		columnMonomials.push_back(it->first);
+	}
+
+	std::vector<Row> rows(rowSources.size());
+	for(std::size_t r = 0; r < rowSources.size(); ++r)
+	{
+		const Polynomial& p = generators[rowSources[r].first];
+		const Monomial::Arg& factor = rowSources[r].second;
+		rows[r].mReasons = p.getReasons();
+		rows[r].mIsReducer = rowIsReducer[r];
+		rows[r].mEntries.reserve(p.nrTerms());
+		for(const auto& term : p)
+		{
+			rows[r].mEntries.emplace_back(columns[term.monomial() * factor], term.coeff());
+		}
+		std::sort(rows[r].mEntries.begin(), rows[r].mEntries.end(), [](const std::pair<std::size_t, Coeff>& lhs, const std::pair<std::size_t, Coeff>& rhs)
+		{
+			return lhs.first < rhs.first;
+		});
+	}
+	std::vector<bool> isLeadingColumn(columnMonomials.size(), false);
+	for(const Row& row : rows)
+	{
+		isLeadingColumn[row.mEntries.front().first] = true;
+	}
+
+	// Rows with small leading monomials are processed first, such that the tails of the later rows can be reduced completely.
+	std::vector<std::size_t> order(rows.size());
+	for(std::size_t r = 0; r < rows.size(); ++r) order[r] = r;
+	std::sort(order.begin(), order.end(), [&rows](std::size_t lhs, std::size_t rhs)
+	{
+		const Row& l = rows[lhs];
+		const Row& r = rows[rhs];
+		if(l.mEntries.front().first != r.mEntries.front().first) return l.mEntries.front().first > r.mEntries.front().first;
+		if(l.mIsReducer != r.mIsReducer) return l.mIsReducer;
+		return l.mEntries.size() < r.mEntries.size();
+	});
+
+	// Bring the matrix into row echelon form.
+	static constexpr std::size_t noPivot = std::numeric_limits<std::size_t>::max();
+	std::vector<std::size_t> pivots(columnMonomials.size(), noPivot);
+	for(std::size_t r : order)
+	{
+		Row& row = rows[r];
+		std::size_t position = 0;
+		while(position < row.mEntries.size())
+		{
+			std::size_t pivot = pivots[row.mEntries[position].first];
+			if(pivot == noPivot)
+			{
+				++position;
+				continue;
+			}
+			Coeff factor = -row.mEntries[position].second;
+			addMultiple(row.mEntries, position, factor, rows[pivot].mEntries);
+			row.mReasons |= rows[pivot].mReasons;
+		}
+		if(row.mEntries.empty()) continue;
+		Coeff lcoeff = row.mEntries.front().second;
+		if(lcoeff != constant_one<Coeff>::get())
+		{
+			for(auto& entry : row.mEntries) entry.second /= lcoeff;
+		}
+		pivots[row.mEntries.front().first] = r;
+	}
+
+	// The pivot rows with new leading monomials are the new basis elements, smallest leading monomial first.
+	std::vector<Polynomial> result;
+	for(std::size_t column = columnMonomials.size(); column-- > 0;)
+	{
+		if(pivots[column] == noPivot || isLeadingColumn[column]) continue;
+		const Row& row = rows[pivots[column]];
+		typename Polynomial::TermsType terms;
+		terms.reserve(row.mEntries.size());
+		for(auto it = row.mEntries.rbegin(); it != row.mEntries.rend(); ++it)
+		{
+			terms.emplace_back(it->second, columnMonomials[it->first]);
+		}
+		result.emplace_back(std::move(terms), false, true);
+		result.back().setReasons(row.mReasons);
+	}
+	return result;
+}
+
+template<class Polynomial, template<typename> class AddingPolicy>
+void F4<Polynomial, AddingPolicy>::addMultiple(std::vector<std::pair<std::size_t, Coeff>>& row, std::size_t position, const Coeff& factor, const std::vector<std::pair<std::size_t, Coeff>>& pivot)
+{
+	assert(!pivot.empty() && position < row.size());
+	assert(pivot.front().first == row[position].first);
+	// The entries before position are not affected, the entry at position cancels.
+	std::vector<std::pair<std::size_t, Coeff>> tail;
+	tail.reserve(row.size() - position + pivot.size());
+	auto rit = row.begin() + std::ptrdiff_t(position) + 1;
+	auto pit = pivot.begin() + 1;
+	while(rit != row.end() && pit != pivot.end())
+	{
+		if(rit->first < pit->first)
+		{
+			tail.push_back(*rit);
+			++rit;
+		}
+		else if(pit->first < rit->first)
+		{
+			tail.emplace_back(pit->first, factor * pit->second);
+			++pit;
+		}
+		else
+		{
+			Coeff sum = rit->second + factor * pit->second;
+			if(!carl::isZero(sum)) tail.emplace_back(rit->first, std::move(sum));
+			++rit;
+			++pit;
+		}
+	}
+	tail.insert(tail.end(), rit, row.end());
+	for(; pit != pivot.end(); ++pit)
+	{
+		tail.emplace_back(pit->first, factor * pit->second);
+	}
+	row.erase(row.begin() + std::ptrdiff_t(position), row.end());
+	row.insert(row.end(), std::make_move_iterator(tail.begin()), std::make_move_iterator(tail.end()));
+}
+
+}
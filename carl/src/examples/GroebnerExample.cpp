@@ -69,6 +69,7 @@ struct ExecuteBenchmarks {
     {
         std::vector<AbstractGBProcedure<Polynomial>*> res;
         res.push_back(new GBProcedure<Polynomial, Buchberger, StdAdding>());
+        res.push_back(new GBProcedure<Polynomial, F4, StdAdding>());
         return res;
     }
 };
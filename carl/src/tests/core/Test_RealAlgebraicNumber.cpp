@@ -3,6 +3,7 @@
 
 #include "carl/core/UnivariatePolynomial.h"
 #include "carl/formula/model/ran/RealAlgebraicNumber.h"
+#include "carl/formula/model/ran/RealAlgebraicNumberComparison.h"
 #include "carl/formula/model/ran/RealAlgebraicNumberEvaluation.h"
 #include "carl/formula/model/ran/RealAlgebraicPoint.h"
 
@@ -67,3 +68,29 @@ TEST(RealAlgebraicNumber, Evaluation2)
 	auto res = RealAlgebraicNumberEvaluation::evaluate(MultivariatePolynomial<Rational>(mp), point, vars);
 	std::cerr << res << std::endl;
 }
+
+TEST(RealAlgebraicNumber, Comparison)
+{
+	Variable x = freshRealVariable("x");
+	UnivariatePolynomial<Rational> p(x, std::initializer_list<Rational>{-2, 0, 1});
+	RealAlgebraicNumber<Rational> sqrt2(p, Interval<Rational>(Rational(1), BoundType::STRICT, Rational(2), BoundType::STRICT));
+	RealAlgebraicNumber<Rational> sqrt2narrow(p, Interval<Rational>(Rational(1), BoundType::STRICT, Rational(3)/2, BoundType::STRICT));
+	RealAlgebraicNumber<Rational> minusSqrt2(p, Interval<Rational>(Rational(-2), BoundType::STRICT, Rational(-1), BoundType::STRICT));
+	RealAlgebraicNumber<Rational> one(Rational(1));
+	RealAlgebraicNumber<Rational> threeHalves(Rational(3)/2);
+
+	RANComparisonTier tier;
+	EXPECT_EQ(-1, carl::compare(one, threeHalves, tier));
+	EXPECT_EQ(RANComparisonTier::Numeric, tier);
+	EXPECT_EQ(1, carl::compare(sqrt2, minusSqrt2, tier));
+	EXPECT_EQ(RANComparisonTier::Approximation, tier);
+	EXPECT_EQ(1, carl::compare(sqrt2, one, tier));
+	// 3/2 lies within the isolating interval of sqrt(2), which is separated by bisection
+	EXPECT_EQ(-1, carl::compare(sqrt2, threeHalves, tier));
+	EXPECT_EQ(RANComparisonTier::Interval, tier);
+	EXPECT_EQ(1, carl::compare(threeHalves, sqrt2, tier));
+	// roots of the same polynomial are checked for equality exactly
+	EXPECT_EQ(0, carl::compare(sqrt2, sqrt2narrow, tier));
+	EXPECT_EQ(RANComparisonTier::Exact, tier);
+	EXPECT_EQ(0, carl::compare(sqrt2, sqrt2));
+}
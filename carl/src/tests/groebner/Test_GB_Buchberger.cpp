@@ -76,3 +76,35 @@ TEST(GB_Buchberger, T1_ReasonSets)
     EXPECT_EQ(x,gb2object.getIdeal().getGenerator(0));
     EXPECT_EQ(y,gb2object.getIdeal().getGenerator(1));
 }
+
+TEST(GB_Buchberger, Snapshot)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+
+    MultivariatePolynomial<Rational> f1({(Rational)1*x*x*x, (Rational)-2*x*y} );
+    MultivariatePolynomial<Rational> f2({(Rational)1*x*x*y, (Rational)-2*y*y, (Rational)1*x});
+    MultivariatePolynomial<Rational> f3({(Rational)1*x, Term<Rational>(-1)});
+    GBProcedure<MultivariatePolynomial<Rational>, Buchberger, StdAdding> gbobject;
+    gbobject.addPolynomial(f1);
+    gbobject.addPolynomial(f2);
+    gbobject.calculate();
+    std::vector<MultivariatePolynomial<Rational>> basis = gbobject.getBasisPolynomials();
+    auto snapshot = gbobject.snapshot();
+    gbobject.addPolynomial(f3);
+    auto scheduled = gbobject.snapshot();
+    gbobject.calculate();
+    EXPECT_TRUE(gbobject.basisIsConstant());
+    // The snapshots are not affected by the calculation.
+    EXPECT_EQ(basis, snapshot.mGb->getGenerators());
+    gbobject.restore(scheduled);
+    EXPECT_FALSE(gbobject.inputEmpty());
+    gbobject.restore(snapshot);
+    EXPECT_TRUE(gbobject.inputEmpty());
+    EXPECT_EQ(2, gbobject.nrOrigGenerators());
+    EXPECT_EQ(basis, gbobject.getBasisPolynomials());
+    gbobject.addPolynomial(f3);
+    gbobject.calculate();
+    EXPECT_TRUE(gbobject.basisIsConstant());
+    EXPECT_EQ(basis, snapshot.mGb->getGenerators());
+}
@@ -0,0 +1,101 @@
+#include "gtest/gtest.h"
+#include "carl/groebner/GBProcedure.h"
+
+#include "carl/groebner/Ideal.h"
+#include "carl/groebner/groebner.h"
+
+#include "../Common.h"
+
+
+using namespace carl;
+
+template<typename Coeff>
+using PolynomialWithReasonSet = MultivariatePolynomial<Coeff, GrLexOrdering, StdMultivariatePolynomialPolicies<BVReasons, NoAllocator>>;
+
+template<typename Polynomial>
+std::vector<Polynomial> sortedBasis(const std::vector<Polynomial>& basis)
+{
+	std::vector<Polynomial> res(basis);
+	std::sort(res.begin(), res.end(), Polynomial::compareByLeadingTerm);
+	return res;
+}
+
+TEST(GB_F4, T1)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+
+	MultivariatePolynomial<Rational> f1({(Rational)1*x*x*x, (Rational)-2*x*y} );
+	MultivariatePolynomial<Rational> f2({(Rational)1*x*x*y, (Rational)-2*y*y, (Rational)1*x});
+	MultivariatePolynomial<Rational> F1({(Rational)1*x*x} );
+	MultivariatePolynomial<Rational> F2({(Rational)1*y*y, (Rational)-1*(Rational)1/(Rational)2*x} );
+	MultivariatePolynomial<Rational> F3({(Rational)1*x*y} );
+	GBProcedure<MultivariatePolynomial<Rational>, F4, StdAdding> gbobject;
+	gbobject.addPolynomial(f1);
+	gbobject.addPolynomial(f2);
+	gbobject.reduceInput();
+	gbobject.calculate();
+	ASSERT_EQ(3, gbobject.getIdeal().nrGenerators());
+	EXPECT_EQ(F1,gbobject.getIdeal().getGenerator(0));
+	EXPECT_EQ(F3,gbobject.getIdeal().getGenerator(1));
+	EXPECT_EQ(F2,gbobject.getIdeal().getGenerator(2));
+}
+
+TEST(GB_F4, Reasons)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+
+	PolynomialWithReasonSet<Rational> f1(MultivariatePolynomial<Rational>({(Rational)1*x*y, Term<Rational>(-1)}));
+	f1.setReasons(BitVector(0));
+	PolynomialWithReasonSet<Rational> f2(MultivariatePolynomial<Rational>({(Rational)1*x}));
+	f2.setReasons(BitVector(1));
+	PolynomialWithReasonSet<Rational> f3(MultivariatePolynomial<Rational>({(Rational)1*y, Term<Rational>(1)}));
+	f3.setReasons(BitVector(2));
+	GBProcedure<PolynomialWithReasonSet<Rational>, F4, StdAdding> gbobject;
+	gbobject.addPolynomial(f1);
+	gbobject.addPolynomial(f2);
+	gbobject.addPolynomial(f3);
+	gbobject.calculate();
+	ASSERT_TRUE(gbobject.basisIsConstant());
+	BitVector reasons = gbobject.getIdeal().getGenerator(0).getReasons();
+	EXPECT_TRUE(reasons.getBit(0));
+	EXPECT_TRUE(reasons.getBit(1));
+}
+
+TEST(GB_F4, SameAsBuchberger)
+{
+	using Polynomial = MultivariatePolynomial<Rational>;
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Variable z = freshRealVariable("z");
+	Variable t = freshRealVariable("t");
+	std::vector<std::vector<Polynomial>> benchmarks = {
+		// katsura4
+		{
+			Polynomial({(Rational)1*x, (Rational)2*y, (Rational)2*z, (Rational)2*t, Term<Rational>(-1)}),
+			Polynomial({(Rational)1*x*x, (Rational)2*y*y, (Rational)2*z*z, (Rational)2*t*t, (Rational)-1*x}),
+			Polynomial({(Rational)2*x*y, (Rational)2*y*z, (Rational)2*z*t, (Rational)-1*y}),
+			Polynomial({(Rational)1*y*y, (Rational)2*x*z, (Rational)2*y*t, (Rational)-1*z})
+		},
+		// cyclic3
+		{
+			Polynomial({(Rational)1*x, (Rational)1*y, (Rational)1*z}),
+			Polynomial({(Rational)1*x*y, (Rational)1*x*z, (Rational)1*y*z}),
+			Polynomial({(Rational)1*x*y*z, Term<Rational>(-1)})
+		}
+	};
+	for(const auto& input : benchmarks)
+	{
+		GBProcedure<Polynomial, Buchberger, StdAdding> buchberger;
+		GBProcedure<Polynomial, F4, StdAdding> f4;
+		for(const auto& p : input)
+		{
+			buchberger.addPolynomial(p);
+			f4.addPolynomial(p);
+		}
+		buchberger.calculate();
+		f4.calculate();
+		EXPECT_EQ(sortedBasis(buchberger.getBasisPolynomials()), sortedBasis(f4.getBasisPolynomials()));
+	}
+}
@@ -19,6 +19,8 @@ namespace benchmax {
 	bool Settings::UseStats;
 	std::string Settings::outputDir;
 	std::vector<std::string> Settings::composeFiles;
+	std::vector<std::string> Settings::compareFiles;
+	double Settings::compareThreshold;
 	
 	std::string Settings::backend;
 	
@@ -27,6 +29,9 @@ namespace benchmax {
 	std::string Settings::ssh_tmpdir;
 	std::size_t Settings::ssh_maxchannels;
 	
+	std::size_t Settings::local_jobs;
+	bool Settings::local_pinning;
+	
 	std::vector<std::string> Settings::pathes;
 	std::string Settings::pathPrefix;
 	std::chrono::seconds Settings::timeLimit;
@@ -36,6 +41,8 @@ namespace benchmax {
 	std::string Settings::WrongResultPath;
 	std::string Settings::StatsXMLFile;
 	std::string Settings::outputFile;
+	std::string Settings::resultStore;
+	bool Settings::rerun;
 	
 	std::vector<std::string> Settings::tools_generic;
 	std::vector<std::string> Settings::tools_smtrat;
@@ -37,6 +37,7 @@ private:
 	po::options_description toolOptions;
 	po::options_description backendOptions;
 	po::options_description backendOptions_SSH;
+	po::options_description backendOptions_Local;
 	po::options_description benchmarkOptions;
 	po::options_description solverOptions;
 	
@@ -49,6 +50,7 @@ public:
 		toolOptions("Tool options", printWidth),
 		backendOptions("Backend options", printWidth),
 		backendOptions_SSH("SSH backend options (if backend = \"SSH\")", printWidth),
+		backendOptions_Local("Local backend options (if backend = \"local\")", printWidth),
 		benchmarkOptions("Benchmark options", printWidth),
 		solverOptions("Solver options", printWidth)
 	{
@@ -66,6 +68,8 @@ public:
 			("stats,s", po::bool_switch(&UseStats), "run solver with statistics")
 			("output-dir,o", po::value<std::string>(&outputDir), "output directory")
 			("compose,c", po::value<std::vector<std::string> >(&composeFiles), "Compose a list of stats files together")
+			("compare", po::value<std::vector<std::string> >(&compareFiles)->multitoken(), "Compare two stats files and report changed answers, runtimes and peak memory")
+			("compare-threshold", po::value<double>(&compareThreshold)->default_value(0.1), "relative change of runtime or memory to be reported by --compare")
 		;
 		backendOptions.add_options()
 			("backend,b", po::value<std::string>(&backend), "Backend to be used. Possible values: \"condor\", \"local\", \"ssh\".")
@@ -76,7 +80,12 @@ public:
             ("basedir", po::value<std::string>(&ssh_basedir)->default_value("~/"), "remote base directory")
             ("tmpdir", po::value<std::string>(&ssh_tmpdir)->default_value("/tmp/"), "remote temporary directory")
 		;
+		backendOptions_Local.add_options()
+			("jobs,j", po::value<std::size_t>(&local_jobs)->default_value(1), "number of jobs to run concurrently")
+			("pin-cpus", po::bool_switch(&local_pinning)->default_value(false), "pin every job to the CPU of its worker")
+		;
 		backendOptions.add(backendOptions_SSH);
+		backendOptions.add(backendOptions_Local);
 		
 		benchmarkOptions.add_options()
 			("include-directory,D", po::value<std::vector<std::string>>(&pathes), "path to look for benchmarks (several are possible)")
@@ -87,6 +96,8 @@ public:
 			("wrong-result-path,W", po::value<std::string>(&WrongResultPath)->default_value("wrong_result/"), "path to the directory to store the wrong results")
 			("stats-xml-file,X", po::value<std::string>(&StatsXMLFile)->default_value("stats.xml"), "path to the xml-file where the statistics are stored")
 			("output-file,f", po::value<std::string>(&outputFile), "output file")
+			("result-store", po::value<std::string>(&resultStore)->default_value(""), "file to store results in; jobs with a stored result for the same binary, arguments, input and limits are not run again")
+			("rerun", po::bool_switch(&rerun)->default_value(false), "run all jobs even if a stored result exists")
 		;
 		solverOptions.add_options()
 			("tool", po::value<std::vector<std::string>>(&tools_generic), "any tool")
@@ -136,6 +147,8 @@ public:
 	static bool UseStats;
 	static std::string outputDir;
 	static std::vector<std::string> composeFiles;
+	static std::vector<std::string> compareFiles;
+	static double compareThreshold;
     
     /// Backend Options
 	static std::string backend;
@@ -146,6 +159,10 @@ public:
     static std::string ssh_tmpdir;
     static std::size_t ssh_maxchannels;
     
+    /// Local Backend Options
+    static std::size_t local_jobs;
+    static bool local_pinning;
+    
     /// Benchmark Options
 	static std::vector<std::string> pathes;
 	static std::string pathPrefix;
@@ -156,6 +173,8 @@ public:
 	static std::string WrongResultPath;
 	static std::string StatsXMLFile;
 	static std::string outputFile;
+	static std::string resultStore;
+	static bool rerun;
     
     /// Solver Options
 	static std::vector<std::string> tools_generic;
@@ -9,18 +9,32 @@
 #include "../tools/Tool.h"
 #include "../utils/regex.h"
 #include "../results/Results.h"
+#include "../results/ResultStore.h"
 
 namespace benchmax {
 
 class Backend {
 private:
 	Results mResults;
+	ResultStore mStore;
+	
+	/**
+	 * Adds the result from the result store, if there is one.
+	 * @return true, if a stored result was used.
+	 */
+	bool useStoredResult(const Tool* tool, const fs::path& file, const fs::path& baseDir) {
+		if (!mStore.enabled() || Settings::rerun) return false;
+		BenchmarkResult results;
+		if (!mStore.lookup(mStore.key(tool, file), results)) return false;
+		mResults.addResult(tool, file, baseDir, results);
+		return true;
+	}
 protected:
 	std::size_t mExpectedJobs;
 	std::atomic<std::size_t> mFinishedJobs;
 	std::atomic<std::size_t> mLastPercent;
 	
-	Backend(): mExpectedJobs(0), mFinishedJobs(0), mLastPercent(0) {}
+	Backend(): mStore(Settings::resultStore), mExpectedJobs(0), mFinishedJobs(0), mLastPercent(0) {}
 	
 	virtual void startTool(const Tool*) {}
 	virtual void execute(const Tool*, const fs::path&, const fs::path&) {}
@@ -37,22 +51,32 @@ public:
 		tool->additionalResults(file, results);
 		results.cleanup(tool, Settings::timeLimit);
 		mResults.addResult(tool, file, baseDir, results);
+		if (mStore.enabled()) mStore.store(mStore.key(tool, file), results);
 	}
 	void run(const std::vector<Tool*>& tools, const std::vector<BenchmarkSet>& benchmarks) {
 		for (const BenchmarkSet& set: benchmarks) {
 			mExpectedJobs += tools.size() * set.size();
 		}
+		std::size_t storedJobs = 0;
 		for (const Tool* tool: tools) {
 			this->startTool(tool);
 			for (const BenchmarkSet& set: benchmarks) {
 				for (const fs::path& file: set) {
 					if (tool->canHandle(file)) {
+						if (useStoredResult(tool, file, set.baseDir())) {
+							storedJobs++;
+							madeProgress();
+							continue;
+						}
 						//BENCHMAX_LOG_DEBUG("benchmax", "Calling " << tool->binary().native() << " on " << file.native());
 						this->execute(tool, file, set.baseDir());
 					}
 				}
 			}
 		}
+		if (mStore.enabled()) {
+			BENCHMAX_LOG_INFO("benchmax", "Reused " << storedJobs << " results from " << Settings::resultStore);
+		}
 		BENCHMAX_LOG_INFO("benchmax", "Scheduled all jobs, waiting for termination.");
 	}
 	virtual ~Backend() {
@@ -6,6 +6,11 @@
 #pragma once
 
 #include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
 
 #include "Backend.h"
 
@@ -15,26 +20,94 @@
 
 namespace benchmax {
 
+/**
+ * Runs all jobs on the local machine.
+ * Jobs are put into a queue and processed by Settings::local_jobs worker threads, each of them running one tool at a time.
+ */
 class LocalBackend: public Backend {
+private:
+	struct Job {
+		const Tool* tool;
+		fs::path file;
+		fs::path baseDir;
+	};
+
+	std::mutex mMutex;
+	std::condition_variable mJobAvailable;
+	std::queue<Job> mJobs;
+	bool mFinished = false;
+	std::vector<std::thread> mWorkers;
+
+	void runJob(const Job& job, int cpu) {
+		ProcessLimits limits;
+		if (Settings::wallclock) limits.wallSeconds = std::size_t(seconds(Settings::timeLimit).count());
+		else limits.cpuSeconds = std::size_t(seconds(Settings::timeLimit).count());
+		limits.memoryMB = Settings::memoryLimit;
+		limits.cpu = cpu;
+
+		BenchmarkResult results;
+		ProcessUsage usage = executeProcess(job.tool->getCommandline(job.file.native()), limits, results.stdout, results.stderr);
+		if (WIFEXITED(usage.status)) {
+			results.exitCode = WEXITSTATUS(usage.status);
+		} else {
+			// Mimic the exit code a shell reports for a process killed by a signal.
+			results.exitCode = WIFSIGNALED(usage.status) ? 128 + WTERMSIG(usage.status) : usage.status;
+		}
+		results.time = Settings::wallclock ? usage.wallTime : usage.cpuTime();
+		results.timeout = usage.limitExceeded;
+		results.userTime = usage.userTime;
+		results.systemTime = usage.systemTime;
+		results.peakMemory = usage.peakMemory;
+		results.minorPageFaults = usage.minorPageFaults;
+		results.majorPageFaults = usage.majorPageFaults;
+		results.voluntaryContextSwitches = usage.voluntaryContextSwitches;
+		results.involuntaryContextSwitches = usage.involuntaryContextSwitches;
+
+		addResult(job.tool, job.file, job.baseDir, results);
+		madeProgress();
+	}
+
+	void work(std::size_t id) {
+		int cpu = -1;
+		if (Settings::local_pinning) {
+			std::size_t cpus = std::thread::hardware_concurrency();
+			if (cpus > 0) cpu = int(id % cpus);
+		}
+		while (true) {
+			Job job;
+			{
+				std::unique_lock<std::mutex> lock(mMutex);
+				mJobAvailable.wait(lock, [this](){ return mFinished || !mJobs.empty(); });
+				if (mJobs.empty()) return;
+				job = std::move(mJobs.front());
+				mJobs.pop();
+			}
+			runJob(job, cpu);
+		}
+	}
 protected:
 	virtual void execute(const Tool* tool, const fs::path& file, const fs::path& baseDir) {
-		std::stringstream call;
-		call << "ulimit -S -t " << seconds(Settings::timeLimit).count() << " && ";
-		call << "ulimit -S -v " << (Settings::memoryLimit * 1024) << " && ";
-		call << "date +\"Start: %s%3N\" && ";
-		call << tool->getCommandline(file.native()) << " 2> stderr.log && ";
-		call << "date +\"End: %s%3N\"";
-	
-		BenchmarkResult results;
-		auto start = std::chrono::high_resolution_clock::now();
-		
-		int exitCode = callProgram(call.str(), results.stdout);
-		results.exitCode = WEXITSTATUS(exitCode);
-		
-		auto end = std::chrono::high_resolution_clock::now();
-		results.time = milliseconds(end - start);
-	
-		addResult(tool, file, baseDir, results);
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			mJobs.push(Job{tool, file, baseDir});
+		}
+		mJobAvailable.notify_one();
+	}
+public:
+	LocalBackend(): Backend() {
+		std::size_t workers = std::max(Settings::local_jobs, std::size_t(1));
+		BENCHMAX_LOG_INFO("benchmax.backend", "Running " << workers << " jobs concurrently.");
+		for (std::size_t i = 0; i < workers; i++) {
+			mWorkers.emplace_back(&LocalBackend::work, this, i);
+		}
+	}
+	~LocalBackend() {
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			mFinished = true;
+		}
+		mJobAvailable.notify_all();
+		for (auto& w: mWorkers) w.join();
 	}
 };
 
@@ -31,6 +31,7 @@ namespace fs = boost::filesystem;
 #include "backends/LocalBackend.h"
 #include "backends/SSHBackend.h"
 
+#include "results/Comparison.h"
 #include "utils/regex.h"
 
 using benchmax::Tool;
@@ -83,6 +84,19 @@ bool initApplication(int argc, char** argv) {
 		std::cout << WARRANTY << std::endl;
 		return false;
 	}
+	if(s.has("compare")) {
+		if (Settings::compareFiles.size() != 2) {
+			BENCHMAX_LOG_FATAL("benchmax", "Comparing results requires exactly two stats files.");
+			return false;
+		}
+		benchmax::Comparison comparison(Settings::compareFiles[0], Settings::compareFiles[1], Settings::compareThreshold);
+		if (!comparison.loaded()) {
+			BENCHMAX_LOG_FATAL("benchmax", "Could not compare the results.");
+			return false;
+		}
+		comparison.report(std::cout);
+		return false;
+	}
 	if(s.has("compose")) {
 		Stats::composeStats(s.composeFiles);
 		return false;
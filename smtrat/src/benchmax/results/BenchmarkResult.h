@@ -10,13 +10,25 @@ struct BenchmarkResult {
 	int exitCode;
 	std::string status;
 	std::chrono::milliseconds time;
+	/// True, if the run was stopped because it exceeded the time limit, regardless of the measured time.
+	bool timeout = false;
+	/// CPU time spent in user mode, zero if it was not measured.
+	std::chrono::milliseconds userTime = std::chrono::milliseconds(0);
+	/// CPU time spent in kernel mode, zero if it was not measured.
+	std::chrono::milliseconds systemTime = std::chrono::milliseconds(0);
+	/// Peak resident set size in kilobytes, zero if it was not measured.
+	std::size_t peakMemory = 0;
+	std::size_t minorPageFaults = 0;
+	std::size_t majorPageFaults = 0;
+	std::size_t voluntaryContextSwitches = 0;
+	std::size_t involuntaryContextSwitches = 0;
 	std::string stdout;
 	std::string stderr;
 	std::map<std::string, std::string> additional;
 	
 	template<typename Tool, typename TimeLimit>
 	void cleanup(const Tool* tool, const TimeLimit& limit) {
-		if (time > limit) {
+		if (timeout || time > limit) {
 			status = "timeout";
 		} else {
 			status = tool->getStatus(*this);
@@ -27,7 +39,8 @@ struct BenchmarkResult {
 };
 
 inline std::ostream& operator<<(std::ostream& os, const BenchmarkResult& results) {
-	os << "(" << results.status << ", " << results.exitCode << ", " << results.time.count() << "ms)" << std::endl;
+	os << "(" << results.status << ", " << results.exitCode << ", " << results.time.count() << "ms, " << results.peakMemory << "KB)" << std::endl;
+	os << "(user " << results.userTime.count() << "ms, system " << results.systemTime.count() << "ms, page faults " << results.minorPageFaults << "/" << results.majorPageFaults << ", context switches " << results.voluntaryContextSwitches << "/" << results.involuntaryContextSwitches << ")" << std::endl;
 	os << results.stdout << std::endl;
 	os << results.stderr << std::endl;
 	return os;
@@ -0,0 +1,185 @@
+/**
+ * @file Comparison.h
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../../cli/config.h"
+#ifdef __VS
+#pragma warning(push, 0)
+#include <boost/property_tree/ptree.hpp>
+#include <boost/property_tree/xml_parser.hpp>
+#pragma warning(pop)
+#else
+#include <boost/property_tree/ptree.hpp>
+#include <boost/property_tree/xml_parser.hpp>
+#endif
+
+#include "../logging.h"
+
+namespace benchmax {
+
+/**
+ * Compares two result files as written by XMLWriter.
+ * Runs are matched by solver, benchmark set and benchmark file. The report lists all runs whose answer changed
+ * and all runs whose runtime or peak memory changed by more than a relative threshold, followed by a summary.
+ */
+class Comparison {
+private:
+	struct Run {
+		std::string answer;
+		std::size_t runtime = 0;
+		std::size_t usertime = 0;
+		std::size_t systemtime = 0;
+		std::size_t peakmemory = 0;
+	};
+	/// Maps (solver, benchmark file) to the run.
+	typedef std::map<std::pair<std::string,std::string>, Run> RunMap;
+
+	struct Change {
+		std::pair<std::string,std::string> run;
+		std::size_t before;
+		std::size_t after;
+		double ratio() const {
+			return double(after + 1) / double(before + 1);
+		}
+	};
+
+	RunMap mOld;
+	RunMap mNew;
+	double mThreshold;
+	bool mLoaded;
+
+	static std::size_t asSize(const std::string& s) {
+		try {
+			return std::stoul(s);
+		} catch (...) {
+			return 0;
+		}
+	}
+
+	static bool load(const std::string& filename, RunMap& runs) {
+		namespace pt = boost::property_tree;
+		pt::ptree tree;
+		try {
+			pt::read_xml(filename, tree);
+		} catch (const pt::xml_parser_error& e) {
+			BENCHMAX_LOG_ERROR("benchmax", "Failed to read " << filename << ": " << e.what());
+			return false;
+		}
+		auto sets = tree.get_child_optional("benchmarksets");
+		if (!sets) {
+			BENCHMAX_LOG_ERROR("benchmax", "Failed to read " << filename << ": no benchmarksets found.");
+			return false;
+		}
+		for (const auto& set: *sets) {
+			if (set.first != "benchmarkset") continue;
+			std::string setName = set.second.get<std::string>("<xmlattr>.name", "");
+			for (const auto& file: set.second) {
+				if (file.first != "benchmarkfile") continue;
+				std::string fileName = setName + "/" + file.second.get<std::string>("<xmlattr>.name", "");
+				for (const auto& run: file.second) {
+					if (run.first != "run") continue;
+					Run& r = runs[std::make_pair(run.second.get<std::string>("<xmlattr>.solver_id", ""), fileName)];
+					auto results = run.second.get_child_optional("results");
+					if (!results) continue;
+					for (const auto& result: *results) {
+						if (result.first != "result") continue;
+						std::string name = result.second.get<std::string>("<xmlattr>.name", "");
+						std::string value = result.second.get_value<std::string>();
+						if (name == "answer") r.answer = value;
+						else if (name == "runtime") r.runtime = asSize(value);
+						else if (name == "usertime") r.usertime = asSize(value);
+						else if (name == "systemtime") r.systemtime = asSize(value);
+						else if (name == "peakmemory") r.peakmemory = asSize(value);
+					}
+				}
+			}
+		}
+		return true;
+	}
+
+	void printChanges(std::ostream& os, const std::string& title, const std::string& unit, std::vector<Change>& changes) const {
+		std::sort(changes.begin(), changes.end(), [](const Change& a, const Change& b){ return a.ratio() > b.ratio(); });
+		os << title << " (" << changes.size() << "):" << std::endl;
+		for (const auto& c: changes) {
+			os << "\t" << c.run.first << " on " << c.run.second << ": " << c.before << unit << " -> " << c.after << unit;
+			os << " (x" << std::fixed << std::setprecision(2) << c.ratio() << ")" << std::endl;
+		}
+	}
+public:
+	/**
+	 * Loads both result files.
+	 * @param oldFile Result file of the reference run.
+	 * @param newFile Result file of the run to be compared against the reference.
+	 * @param threshold Relative change (e.g. 0.1 for 10%) above which runtimes and memory usage are reported.
+	 */
+	Comparison(const std::string& oldFile, const std::string& newFile, double threshold): mThreshold(threshold) {
+		mLoaded = load(oldFile, mOld);
+		mLoaded = load(newFile, mNew) && mLoaded;
+	}
+
+	/**
+	 * @return Whether both result files could be read.
+	 */
+	bool loaded() const {
+		return mLoaded;
+	}
+
+	void report(std::ostream& os) const {
+		std::vector<std::pair<std::string,std::string>> changedAnswers;
+		std::vector<Change> runtime;
+		std::vector<Change> memory;
+		std::size_t common = 0;
+		std::size_t oldTime = 0, newTime = 0;
+		std::size_t oldCPU = 0, newCPU = 0;
+		std::size_t oldMemory = 0, newMemory = 0;
+		double logTimeRatio = 0;
+		double logMemoryRatio = 0;
+		for (const auto& o: mOld) {
+			auto n = mNew.find(o.first);
+			if (n == mNew.end()) continue;
+			common++;
+			const Run& a = o.second;
+			const Run& b = n->second;
+			if (a.answer != b.answer) changedAnswers.push_back(o.first);
+			oldTime += a.runtime;
+			newTime += b.runtime;
+			oldCPU += a.usertime + a.systemtime;
+			newCPU += b.usertime + b.systemtime;
+			oldMemory += a.peakmemory;
+			newMemory += b.peakmemory;
+			Change t{o.first, a.runtime, b.runtime};
+			Change m{o.first, a.peakmemory, b.peakmemory};
+			logTimeRatio += std::log(t.ratio());
+			logMemoryRatio += std::log(m.ratio());
+			if (std::abs(t.ratio() - 1) > mThreshold) runtime.push_back(t);
+			if (std::abs(m.ratio() - 1) > mThreshold) memory.push_back(m);
+		}
+		os << "Compared " << common << " runs (" << mOld.size() << " old, " << mNew.size() << " new)." << std::endl;
+		os << "Changed answers (" << changedAnswers.size() << "):" << std::endl;
+		for (const auto& r: changedAnswers) {
+			os << "\t" << r.first << " on " << r.second << ": " << mOld.at(r).answer << " -> " << mNew.at(r).answer << std::endl;
+		}
+		printChanges(os, "Changed runtimes", "ms", runtime);
+		printChanges(os, "Changed peak memory", "KB", memory);
+		if (common == 0) return;
+		os << "Summary:" << std::endl;
+		os << "\tTotal runtime: " << oldTime << "ms -> " << newTime << "ms" << std::endl;
+		os << "\tTotal CPU time: " << oldCPU << "ms -> " << newCPU << "ms" << std::endl;
+		os << "\tTotal peak memory: " << oldMemory << "KB -> " << newMemory << "KB" << std::endl;
+		os << "\tGeometric mean of runtime ratios: " << std::fixed << std::setprecision(3) << std::exp(logTimeRatio / double(common)) << std::endl;
+		os << "\tGeometric mean of peak memory ratios: " << std::fixed << std::setprecision(3) << std::exp(logMemoryRatio / double(common)) << std::endl;
+	}
+};
+
+}
@@ -0,0 +1,208 @@
+/**
+ * @file ResultStore.h
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../logging.h"
+#include "../Settings.h"
+#include "../tools/Tool.h"
+#include "../utils/durations.h"
+#include "BenchmarkResult.h"
+
+namespace benchmax {
+
+/**
+ * Persistent cache of benchmark results.
+ * Every result is identified by the content of the tool binary, the tool arguments, the content of the input file
+ * and the limits it was obtained with. Results are appended to a journal file as soon as they are available, hence
+ * an interrupted run can be resumed and a rerun only executes jobs whose key is not yet contained in the store.
+ * Changing the binary, the arguments, the input or the limits changes the key and thereby invalidates the result.
+ */
+class ResultStore {
+private:
+	std::mutex mMutex;
+	bool mEnabled;
+	std::ofstream mJournal;
+	std::map<std::string, BenchmarkResult> mResults;
+	/// Content hashes of files that have already been hashed.
+	std::map<fs::path, std::string> mHashes;
+
+	/// Computes the 64 bit FNV-1a hash of the content of the given file, or uses the path if the file does not exist.
+	static std::string hashFile(const fs::path& file) {
+		if (!fs::is_regular_file(file)) return file.native();
+		std::uint64_t hash = 14695981039346656037ULL;
+		std::ifstream in(file.native(), std::ios::binary);
+		char buf[65536];
+		while (in) {
+			in.read(buf, sizeof(buf));
+			std::streamsize n = in.gcount();
+			for (std::streamsize i = 0; i < n; i++) {
+				hash ^= std::uint64_t(static_cast<unsigned char>(buf[i]));
+				hash *= 1099511628211ULL;
+			}
+		}
+		std::stringstream ss;
+		ss << std::hex << hash;
+		return ss.str();
+	}
+
+	const std::string& fileHash(const fs::path& file) {
+		auto it = mHashes.find(file);
+		if (it == mHashes.end()) {
+			it = mHashes.emplace(file, hashFile(file)).first;
+		}
+		return it->second;
+	}
+
+	static std::string escape(const std::string& s) {
+		std::string res;
+		for (char c: s) {
+			switch (c) {
+				case '\\': res += "\\\\"; break;
+				case '\t': res += "\\t"; break;
+				case '\n': res += "\\n"; break;
+				default: res += c;
+			}
+		}
+		return res;
+	}
+	static std::string unescape(const std::string& s) {
+		std::string res;
+		for (std::size_t i = 0; i < s.size(); i++) {
+			if (s[i] == '\\' && i + 1 < s.size()) {
+				i++;
+				switch (s[i]) {
+					case 't': res += '\t'; break;
+					case 'n': res += '\n'; break;
+					default: res += s[i];
+				}
+			} else {
+				res += s[i];
+			}
+		}
+		return res;
+	}
+	static std::vector<std::string> split(const std::string& line) {
+		std::vector<std::string> res;
+		std::size_t start = 0;
+		while (true) {
+			std::size_t pos = line.find('\t', start);
+			res.push_back(unescape(line.substr(start, pos - start)));
+			if (pos == std::string::npos) break;
+			start = pos + 1;
+		}
+		return res;
+	}
+
+	/**
+	 * Parses a journal line of the form key, exit code, status, time, user time, system time, peak memory,
+	 * minor and major page faults, voluntary and involuntary context switches and pairs of additional results.
+	 */
+	bool parse(const std::string& line) {
+		std::vector<std::string> fields = split(line);
+		if (fields.size() < 11 || fields.size() % 2 == 0) return false;
+		try {
+			BenchmarkResult r;
+			r.exitCode = std::stoi(fields[1]);
+			r.status = fields[2];
+			r.time = std::chrono::milliseconds(std::stoull(fields[3]));
+			r.userTime = std::chrono::milliseconds(std::stoull(fields[4]));
+			r.systemTime = std::chrono::milliseconds(std::stoull(fields[5]));
+			r.peakMemory = std::stoull(fields[6]);
+			r.minorPageFaults = std::stoull(fields[7]);
+			r.majorPageFaults = std::stoull(fields[8]);
+			r.voluntaryContextSwitches = std::stoull(fields[9]);
+			r.involuntaryContextSwitches = std::stoull(fields[10]);
+			for (std::size_t i = 11; i + 1 < fields.size(); i += 2) {
+				r.additional[fields[i]] = fields[i+1];
+			}
+			mResults[fields[0]] = r;
+		} catch (const std::exception&) {
+			return false;
+		}
+		return true;
+	}
+public:
+	/**
+	 * Loads all results from the given journal and opens it for appending.
+	 * If the filename is empty, the store is disabled.
+	 */
+	ResultStore(const std::string& filename): mEnabled(!filename.empty()) {
+		if (!mEnabled) return;
+		std::ifstream in(filename);
+		std::string line;
+		std::size_t invalid = 0;
+		while (std::getline(in, line)) {
+			// An interrupted run may have left an incomplete last line.
+			if (!line.empty() && !parse(line)) invalid++;
+		}
+		if (invalid > 0) {
+			BENCHMAX_LOG_WARN("benchmax", "Ignored " << invalid << " invalid entries in result store " << filename);
+		}
+		BENCHMAX_LOG_INFO("benchmax", "Loaded " << mResults.size() << " results from " << filename);
+		// Terminate an incomplete last line, such that new results start on a line of their own.
+		bool terminated = true;
+		std::ifstream last(filename, std::ios::binary | std::ios::ate);
+		if (last && last.tellg() > 0) {
+			last.seekg(-1, std::ios::end);
+			terminated = (last.get() == '\n');
+		}
+		mJournal.open(filename, std::ios::out | std::ios::app);
+		if (!terminated) mJournal << std::endl;
+	}
+
+	bool enabled() const {
+		return mEnabled;
+	}
+
+	/**
+	 * Computes the key of running the given tool on the given file with the current limits.
+	 */
+	std::string key(const Tool* tool, const fs::path& file) {
+		std::lock_guard<std::mutex> lock(mMutex);
+		std::stringstream ss;
+		ss << tool->name() << ":" << fileHash(tool->binary()) << " " << tool->arguments();
+		ss << " | " << fileHash(file);
+		ss << " | " << seconds(Settings::timeLimit).count() << "s " << Settings::memoryLimit << "MB" << (Settings::wallclock ? " wall" : " cpu");
+		return ss.str();
+	}
+
+	/**
+	 * Looks up a result.
+	 * @return true, if a result for the key was found.
+	 */
+	bool lookup(const std::string& key, BenchmarkResult& result) {
+		std::lock_guard<std::mutex> lock(mMutex);
+		auto it = mResults.find(key);
+		if (it == mResults.end()) return false;
+		result = it->second;
+		return true;
+	}
+
+	/**
+	 * Stores a result and immediately writes it to the journal.
+	 */
+	void store(const std::string& key, const BenchmarkResult& r) {
+		std::lock_guard<std::mutex> lock(mMutex);
+		mResults[key] = r;
+		mJournal << escape(key) << "\t" << r.exitCode << "\t" << escape(r.status) << "\t" << milliseconds(r.time).count();
+		mJournal << "\t" << milliseconds(r.userTime).count() << "\t" << milliseconds(r.systemTime).count() << "\t" << r.peakMemory;
+		mJournal << "\t" << r.minorPageFaults << "\t" << r.majorPageFaults;
+		mJournal << "\t" << r.voluntaryContextSwitches << "\t" << r.involuntaryContextSwitches;
+		for (const auto& it: r.additional) {
+			mJournal << "\t" << escape(it.first) << "\t" << escape(it.second);
+		}
+		mJournal << std::endl;
+	}
+};
+
+}
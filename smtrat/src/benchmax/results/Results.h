@@ -59,7 +59,15 @@ public:
 			for (const auto& it: set.second.data) {
 				std::size_t tool = toolIDs[it.first.first];
 				std::size_t file = fileIDs[it.first.second];
-				std::size_t id = db.addBenchmarkResult(benchmarkID, tool, file, it.second.exitCode, std::size_t(milliseconds(it.second.time).count()));
+				const BenchmarkResult& r = it.second;
+				std::size_t id = db.addBenchmarkResult(benchmarkID, tool, file, r.exitCode, std::size_t(milliseconds(r.time).count()), r.peakMemory);
+				// The result table only has columns for time and memory, the remaining resources are stored as attributes.
+				db.addBenchmarkAttribute(id, "usertime", std::to_string(milliseconds(r.userTime).count()));
+				db.addBenchmarkAttribute(id, "systemtime", std::to_string(milliseconds(r.systemTime).count()));
+				db.addBenchmarkAttribute(id, "minorpagefaults", std::to_string(r.minorPageFaults));
+				db.addBenchmarkAttribute(id, "majorpagefaults", std::to_string(r.majorPageFaults));
+				db.addBenchmarkAttribute(id, "voluntarycontextswitches", std::to_string(r.voluntaryContextSwitches));
+				db.addBenchmarkAttribute(id, "involuntarycontextswitches", std::to_string(r.involuntaryContextSwitches));
 				for (const auto& attr: it.second.additional) {
 					db.addBenchmarkAttribute(id, attr.first, attr.second);
 				}
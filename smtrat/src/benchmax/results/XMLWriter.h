@@ -81,6 +81,13 @@ public:
 					}
 					mFile << "\t\t\t\t<results>" << std::endl;
 					mFile << "\t\t\t\t\t<result name=\"runtime\" type=\"msec\">" << milliseconds(it->second.time).count() << "</result>" << std::endl;
+					mFile << "\t\t\t\t\t<result name=\"usertime\" type=\"msec\">" << milliseconds(it->second.userTime).count() << "</result>" << std::endl;
+					mFile << "\t\t\t\t\t<result name=\"systemtime\" type=\"msec\">" << milliseconds(it->second.systemTime).count() << "</result>" << std::endl;
+					mFile << "\t\t\t\t\t<result name=\"peakmemory\" type=\"kbyte\">" << it->second.peakMemory << "</result>" << std::endl;
+					mFile << "\t\t\t\t\t<result name=\"minorpagefaults\" type=\"int\">" << it->second.minorPageFaults << "</result>" << std::endl;
+					mFile << "\t\t\t\t\t<result name=\"majorpagefaults\" type=\"int\">" << it->second.majorPageFaults << "</result>" << std::endl;
+					mFile << "\t\t\t\t\t<result name=\"voluntarycontextswitches\" type=\"int\">" << it->second.voluntaryContextSwitches << "</result>" << std::endl;
+					mFile << "\t\t\t\t\t<result name=\"involuntarycontextswitches\" type=\"int\">" << it->second.involuntaryContextSwitches << "</result>" << std::endl;
 					mFile << "\t\t\t\t\t<result name=\"exitcode\" type=\"int\">" << it->second.exitCode << "</result>" << std::endl;
 					mFile << "\t\t\t\t\t<result name=\"answer\" type=\"\">" << it->second.status << "</result>" << std::endl;
 					mFile << "\t\t\t\t</results>" << std::endl;
@@ -52,6 +52,10 @@ public:
 		return mBinary;
 	}
 	
+	const std::string& arguments() const {
+		return mArguments;
+	}
+	
 	const std::map<std::string,std::string>& attributes() const {
 		return mAttributes;
 	}
@@ -5,6 +5,23 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <thread>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sched.h>
+#include <signal.h>
+#include <sys/resource.h>
+#include <sys/time.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
 namespace benchmax {
 
 int callProgram(const std::string& commandline, std::string& stdout) {
@@ -18,4 +35,191 @@ int callProgram(const std::string& commandline, std::string& stdout) {
 	return pclose(pipe);
 }
 
-}
\ No newline at end of file
+/**
+ * Limits and placement of a process started by executeProcess().
+ */
+struct ProcessLimits {
+	/// CPU time limit in seconds, zero means no limit.
+	std::size_t cpuSeconds = 0;
+	/// Wall clock limit in seconds, zero means no limit.
+	std::size_t wallSeconds = 0;
+	/// Limit of the address space in megabytes, zero means no limit.
+	std::size_t memoryMB = 0;
+	/// CPU to pin the process to, negative means no pinning.
+	int cpu = -1;
+};
+
+/**
+ * Resources used by a process started by executeProcess(), as reported by wait4().
+ */
+struct ProcessUsage {
+	/// Raw status as returned by wait4().
+	int status = 0;
+	/// True, if the process was stopped because it exceeded its CPU time or wall clock limit.
+	bool limitExceeded = false;
+	std::chrono::milliseconds wallTime = std::chrono::milliseconds(0);
+	std::chrono::milliseconds userTime = std::chrono::milliseconds(0);
+	std::chrono::milliseconds systemTime = std::chrono::milliseconds(0);
+	/// Peak resident set size in kilobytes.
+	std::size_t peakMemory = 0;
+	std::size_t minorPageFaults = 0;
+	std::size_t majorPageFaults = 0;
+	std::size_t voluntaryContextSwitches = 0;
+	std::size_t involuntaryContextSwitches = 0;
+
+	std::chrono::milliseconds cpuTime() const {
+		return userTime + systemTime;
+	}
+};
+
+inline std::chrono::milliseconds toMilliseconds(const timeval& tv) {
+	return std::chrono::milliseconds(std::size_t(tv.tv_sec) * 1000 + std::size_t(tv.tv_usec) / 1000);
+}
+
+/**
+ * Checks whether a process started via /bin/sh was terminated by the given signal.
+ * The shell either is replaced by the tool or reports the signal of the tool as exit code 128 + signal.
+ */
+inline bool terminatedBy(int status, int signal) {
+	if (WIFSIGNALED(status)) return WTERMSIG(status) == signal;
+	return WIFEXITED(status) && WEXITSTATUS(status) == 128 + signal;
+}
+
+/**
+ * Runs the given command line via /bin/sh within the given limits and collects its output.
+ * In contrast to callProgram(), stdout and stderr are captured separately and the resources used by
+ * the process are measured by the kernel via wait4() instead of being parsed from the output.
+ * The resources reported by the kernel include all descendants of the shell, hence also the tool itself.
+ * The wall clock limit is enforced by killing the whole process group once it is exceeded.
+ * This function is thread-safe and may be called concurrently.
+ * @param commandline Command line to execute.
+ * @param limits Limits to impose on the process.
+ * @param stdout Receives the output of the process.
+ * @param stderr Receives the error output of the process.
+ * @return Resources used by the process.
+ */
+inline ProcessUsage executeProcess(const std::string& commandline, const ProcessLimits& limits, std::string& stdout, std::string& stderr) {
+	ProcessUsage usage;
+	int outPipe[2];
+	int errPipe[2];
+	if (pipe2(outPipe, O_CLOEXEC) != 0) {
+		usage.status = -1;
+		return usage;
+	}
+	if (pipe2(errPipe, O_CLOEXEC) != 0) {
+		close(outPipe[0]);
+		close(outPipe[1]);
+		usage.status = -1;
+		return usage;
+	}
+	auto start = std::chrono::steady_clock::now();
+	auto deadline = start + std::chrono::seconds(limits.wallSeconds);
+	pid_t pid = fork();
+	if (pid == 0) {
+		// Child: only async-signal-safe calls until exec.
+		setpgid(0, 0);
+		dup2(outPipe[1], STDOUT_FILENO);
+		dup2(errPipe[1], STDERR_FILENO);
+		if (limits.cpuSeconds > 0) {
+			rlimit rl;
+			rl.rlim_cur = limits.cpuSeconds;
+			rl.rlim_max = limits.cpuSeconds + 1;
+			setrlimit(RLIMIT_CPU, &rl);
+		}
+		if (limits.memoryMB > 0) {
+			rlimit rl;
+			rl.rlim_cur = rl.rlim_max = limits.memoryMB * 1024 * 1024;
+			setrlimit(RLIMIT_AS, &rl);
+		}
+#ifdef __linux__
+		if (limits.cpu >= 0) {
+			cpu_set_t set;
+			CPU_ZERO(&set);
+			CPU_SET(limits.cpu, &set);
+			sched_setaffinity(0, sizeof(set), &set);
+		}
+#endif
+		execl("/bin/sh", "sh", "-c", commandline.c_str(), static_cast<char*>(nullptr));
+		_exit(127);
+	}
+	close(outPipe[1]);
+	close(errPipe[1]);
+	if (pid < 0) {
+		close(outPipe[0]);
+		close(errPipe[0]);
+		usage.status = -1;
+		return usage;
+	}
+	setpgid(pid, pid);
+	bool killed = false;
+	auto killOnDeadline = [&]() {
+		if (limits.wallSeconds > 0 && !killed && std::chrono::steady_clock::now() >= deadline) {
+			kill(-pid, SIGKILL);
+			killed = true;
+		}
+	};
+	// Read both pipes until they are closed, such that the process never blocks on a full pipe.
+	pollfd fds[2] = { { outPipe[0], POLLIN, 0 }, { errPipe[0], POLLIN, 0 } };
+	std::string* targets[2] = { &stdout, &stderr };
+	int open = 2;
+	char buf[4096];
+	while (open > 0) {
+		int timeout = -1;
+		if (limits.wallSeconds > 0 && !killed) {
+			auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now()).count();
+			timeout = int(std::max(remaining, decltype(remaining)(0))) + 1;
+		}
+		int ready = poll(fds, 2, timeout);
+		killOnDeadline();
+		if (ready < 0) {
+			if (errno == EINTR) continue;
+			break;
+		}
+		for (std::size_t i = 0; i < 2; i++) {
+			if (fds[i].fd < 0 || fds[i].revents == 0) continue;
+			ssize_t n = read(fds[i].fd, buf, sizeof(buf));
+			if (n > 0) {
+				targets[i]->append(buf, std::size_t(n));
+			} else if (n == 0 || errno != EINTR) {
+				close(fds[i].fd);
+				fds[i].fd = -1;
+				open--;
+			}
+		}
+	}
+	for (std::size_t i = 0; i < 2; i++) {
+		if (fds[i].fd >= 0) close(fds[i].fd);
+	}
+	rusage ru;
+	while (true) {
+		pid_t res = wait4(pid, &usage.status, (limits.wallSeconds > 0 && !killed) ? WNOHANG : 0, &ru);
+		if (res == pid) break;
+		if (res < 0 && errno != EINTR) {
+			usage.status = -1;
+			return usage;
+		}
+		if (res == 0) {
+			// The process closed its output but is still running.
+			std::this_thread::sleep_for(std::chrono::milliseconds(10));
+			killOnDeadline();
+		}
+	}
+	usage.wallTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+	usage.userTime = toMilliseconds(ru.ru_utime);
+	usage.systemTime = toMilliseconds(ru.ru_stime);
+	usage.peakMemory = std::size_t(ru.ru_maxrss);
+	usage.minorPageFaults = std::size_t(ru.ru_minflt);
+	usage.majorPageFaults = std::size_t(ru.ru_majflt);
+	usage.voluntaryContextSwitches = std::size_t(ru.ru_nvcsw);
+	usage.involuntaryContextSwitches = std::size_t(ru.ru_nivcsw);
+	// The soft CPU limit sends SIGXCPU, the hard limit one second later SIGKILL. The measured CPU time may be
+	// slightly below the limit, hence the signal decides whether the limit was exceeded.
+	usage.limitExceeded = killed;
+	if (limits.cpuSeconds > 0 && !usage.limitExceeded) {
+		usage.limitExceeded = terminatedBy(usage.status, SIGXCPU)
+			|| (terminatedBy(usage.status, SIGKILL) && usage.cpuTime() >= std::chrono::seconds(limits.cpuSeconds));
+	}
+	return usage;
+}
+
+}
@@ -22,6 +22,7 @@
 #include "../lib/Common.h"
 
 #include "../lib/datastructures/unsatcore/UnsatCore.h"
+#include "../lib/utilities/trace/SpanRecorder.h"
 
 #ifdef SMTRAT_DEVOPTION_Statistics
 #include "../lib/utilities/stats/CollectStatistics.h"
@@ -315,6 +316,8 @@ int main( int argc, char* argv[] )
     #ifdef SMTRAT_DEVOPTION_Statistics
     settingsManager.addSettingsObject("stats", smtrat::CollectStatistics::settings);
     #endif
+    // Introduce the settings object for the span recorder to the manager.
+    settingsManager.addSettingsObject("trace", smtrat::trace::SpanRecorder::settings);
 
     // Parse command line.
     pathToInputFile = settingsManager.parseCommandline( argc, argv );
@@ -395,6 +398,9 @@ int main( int argc, char* argv[] )
     smtrat::CollectStatistics::exportXML();
     #endif
 
+    // Export recorded spans.
+    smtrat::trace::SpanRecorder::exportTrace();
+
 
     // Delete the solver and the formula.
     delete solver;
@@ -5,10 +5,12 @@
 
 #pragma once
 
+#include <algorithm>
 #include <atomic>
 #include <cassert>
-#include <chrono>
-#include <future>
+#include <condition_variable>
+#include <map>
+#include <mutex>
 #include <queue>
 #include <sstream>
 #include <thread>
@@ -23,89 +25,163 @@ namespace delta {
 
 /**
  * This class takes care of asynchronous execution of calls to the solver.
+ *
+ * Candidates are checked by a fixed pool of worker threads.
+ * A candidate is described by a node of the current root and its replacement, hence candidates are only cloned by the workers.
+ * Once a batch of successful candidates has been found, no further candidates are accepted.
+ * All successful candidates that modify disjoint parts of the root are then combined into a single reduction.
  */
 class Consumer {
 private:
+	/// A reduction candidate: replace the node `from` by `to`, or remove it.
+	struct Candidate {
+		const Node* root;
+		const Node* from;
+		Node to;
+		bool removal;
+		std::string message;
+		std::size_t num;
+		Node apply() const {
+			return root->clone(from, removal ? nullptr : &to);
+		}
+	};
 	/// Filename generator.
 	TempFilenameGenerator temp;
 	// Checker object.
 	const Checker& checker;
-	/// List of job results not checked yet.
-	std::queue<std::future<void>> jobs;
-	/// Flag if a call was successful.
+	/// Worker threads.
+	std::vector<std::thread> workers;
+	/// Number of successful candidates after which no further candidates are accepted.
+	std::size_t batchSize;
+	/// Mutex for the queue, the results and the counters below.
+	std::mutex mutex;
+	/// Notified if a candidate is queued or the pool is shut down.
+	std::condition_variable jobAvailable;
+	/// Notified if a candidate has been checked.
+	std::condition_variable jobFinished;
+	/// Candidates not checked yet.
+	std::queue<Candidate> jobs;
+	/// Number of candidates queued or currently being checked.
+	std::size_t pending;
+	/// Flag if the workers shall terminate.
+	bool finished;
+	/// Successful candidates.
+	std::vector<Candidate> results;
+	/// Flag if enough candidates were successful.
 	std::atomic<bool> found;
-	/// Mutex for changes to result.
-	std::mutex resultMutex;
-	/// Result of successful call, consisting of node, message and number of node.
-	std::tuple<Node, std::string, std::size_t> result;
 	/// Number of jobs that have been started.
 	std::atomic<unsigned> jobcount;
 	/// Number of jobs that have terminated.
 	std::atomic<unsigned> progress;
 
 	/**
-	 * Calls the checker and checks the result.
-	 * Method that is called by `std::async`.
-     * @param n Node to check.
-     * @param checker Checker.
-     * @param message Message, if check is successful.
+	 * Calls the checker for the given candidate and stores it, if the check is successful.
+     * @param c Candidate to check.
      */
-	void performCheck(const Node& n, const std::string& message, std::size_t num) {
-		if (hasResult()) {
-			progress++;
-			return;
+	void performCheck(Candidate& c) {
+		bool res = false;
+		if (!hasResult()) {
+			std::string tmp = temp.get();
+			res = checker(c.apply(), tmp);
+			temp.put(tmp);
 		}
-		std::string tmp = temp.get();
-		bool res = checker(n, tmp);
-		temp.put(tmp);
+		std::lock_guard<std::mutex> guard(mutex);
 		progress++;
 		if (res) {
-			std::lock_guard<std::mutex> guard(resultMutex);
-			if (!found) result = std::make_tuple(n, message, num);
-			found = true;
+			results.push_back(std::move(c));
+			if (results.size() >= batchSize) found = true;
 		}
+		pending--;
+		jobFinished.notify_all();
+	}
+	/**
+	 * Main loop of a worker thread.
+	 */
+	void work() {
+		while (true) {
+			Candidate c;
+			{
+				std::unique_lock<std::mutex> lock(mutex);
+				jobAvailable.wait(lock, [this](){ return finished || !jobs.empty(); });
+				if (jobs.empty()) return;
+				c = std::move(jobs.front());
+				jobs.pop();
+			}
+			performCheck(c);
+		}
+	}
+	/**
+	 * Checks whether the node `n` is contained in the subtree rooted at `tree`.
+	 */
+	static bool contains(const Node* tree, const Node* n) {
+		if (tree == n) return true;
+		for (const auto& c: tree->children) {
+			if (contains(&c, n)) return true;
+		}
+		return false;
+	}
+	/**
+	 * Checks whether two candidates modify disjoint parts of the root.
+	 */
+	static bool compatible(const Candidate& a, const Candidate& b) {
+		return !contains(a.from, b.from) && !contains(b.from, a.from);
 	}
 public:
 	/**
 	 * Constructor.
      * @param tempPrefix Prefix for temporary files.
+     * @param checker Checker.
+     * @param threads Number of worker threads.
+     * @param batch Number of successful candidates to collect before reductions are combined.
      */
-	Consumer(const std::string& tempPrefix, const Checker& checker): temp(tempPrefix), checker(checker), found(false) {
+	Consumer(const std::string& tempPrefix, const Checker& checker, std::size_t threads, std::size_t batch):
+		temp(tempPrefix), checker(checker), batchSize(std::max(batch, (std::size_t)1)), pending(0), finished(false), found(false)
+	{
 		reset();
+		for (std::size_t i = 0; i < std::max(threads, (std::size_t)1); i++) {
+			workers.emplace_back(&Consumer::work, this);
+		}
 	}
 	/**
 	 * Destructor.
      */
 	~Consumer() {
 		reset();
+		{
+			std::lock_guard<std::mutex> guard(mutex);
+			finished = true;
+		}
+		jobAvailable.notify_all();
+		for (auto& w: workers) w.join();
 	}
 	/**
-	 * Initiate asynchronous check for the given node.
-     * @param n Node to check.
-     * @param c Checker.
+	 * Queue a check for replacing `from` by `to` (or removing it, if `to` is a nullptr) within `root`.
+	 * Blocks while all workers are busy. `root` must not be modified until all jobs have finished.
+     * @param root Current root.
+     * @param from Node to replace.
+     * @param to Replacement.
      * @param message Message.
+     * @param num Number of the node.
      */
-	void consume(const Node& n, const std::string& message, std::size_t num) {
-		if (hasResult()) return;
-		std::size_t concurrency = std::thread::hardware_concurrency();
-		while (jobs.size() >= concurrency) {
-			while (!jobs.empty() && jobs.front().wait_for(std::chrono::seconds(0)) == std::future_status::ready) jobs.pop();
-			std::this_thread::sleep_for(std::chrono::milliseconds(50));
-		}
+	void consume(const Node& root, const Node* from, const Node* to, const std::string& message, std::size_t num) {
+		std::unique_lock<std::mutex> lock(mutex);
+		jobFinished.wait(lock, [this](){ return hasResult() || pending < workers.size(); });
 		if (hasResult()) return;
 		jobcount++;
-		jobs.push(std::async(std::launch::async, &Consumer::performCheck, this, n, message, num));
+		pending++;
+		jobs.push(Candidate{ &root, from, to == nullptr ? Node() : *to, to == nullptr, message, num });
+		jobAvailable.notify_one();
 	}
 	/**
 	 * Wait for at least one job to finish.
      * @return If all jobs have finished.
      */
 	bool wait() {
-		if (!jobs.empty()) {
-			jobs.front().get();
-			jobs.pop();
-		}
-		return jobs.empty();
+		std::unique_lock<std::mutex> lock(mutex);
+		if (pending == 0) return true;
+		unsigned done = progress;
+		jobFinished.wait(lock, [this,done](){ return pending == 0 || progress != done; });
+		return pending == 0;
 	}
 	/**
 	 * Reset this executor.
@@ -113,26 +189,59 @@ public:
      */
 	void reset() {
 		checker.resetKilled();
-		while (!jobs.empty()) wait();
+		while (!wait());
+		std::lock_guard<std::mutex> guard(mutex);
 		found = false;
-		result = std::make_tuple(Node(), "", 0);
+		results.clear();
 		jobcount = 0;
 		progress = 0;
 	}
 	/**
-	 * Checks if at least one job was successful.
-     * @return If a result is there.
+	 * Checks if enough jobs were successful such that no further candidates are accepted.
+     * @return If no further candidates are accepted.
      */
 	bool hasResult() const {
 		return found;
 	}
 	/**
-	 * Returns the result, assuming that one exists.
-     * @return Result.
+	 * Checks if at least one job was successful.
+	 * Must only be called after all jobs have finished.
+     * @return If a result is there.
+     */
+	bool hasAnyResult() const {
+		return !results.empty();
+	}
+	/**
+	 * Returns the result, assuming that one exists and all jobs have finished.
+	 * If several candidates were successful, all of them that modify disjoint parts of the root are applied at once.
+	 * As reductions may interfere, the combination is checked again and the first successful candidate is used if the check fails.
+     * @return Result, consisting of node, message and number of node.
      */
 	std::tuple<Node, std::string, std::size_t> getResult() {
-		assert(hasResult());
-		return result;
+		assert(hasAnyResult());
+		std::sort(results.begin(), results.end(), [](const Candidate& a, const Candidate& b){ return a.num < b.num; });
+		const Candidate& first = results.front();
+		std::vector<const Candidate*> combined({ &first });
+		for (const auto& c: results) {
+			if (std::all_of(combined.begin(), combined.end(), [&c](const Candidate* d){ return compatible(c, *d); })) {
+				combined.push_back(&c);
+			}
+		}
+		if (combined.size() > 1) {
+			std::map<const Node*, const Node*> replacements;
+			std::stringstream message;
+			for (const Candidate* c: combined) {
+				replacements.emplace(c->from, c->removal ? nullptr : &c->to);
+				if (c != &first) message << std::endl << "         ";
+				message << c->message;
+			}
+			Node n = first.root->clone(replacements);
+			std::string tmp = temp.get();
+			bool res = checker(n, tmp);
+			temp.put(tmp);
+			if (res) return std::make_tuple(n, message.str(), first.num);
+		}
+		return std::make_tuple(first.apply(), first.message, first.num);
 	}
 	/**
 	 * Returns the current progress.
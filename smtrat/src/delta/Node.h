@@ -7,6 +7,7 @@
 
 #include <numeric>
 #include <iostream>
+#include <map>
 #include <set>
 #include <utility>
 #include <vector>
@@ -140,6 +141,27 @@ struct Node {
 		return Node(std::make_tuple(name, newChildren, brackets));
 	}
 
+	/**
+	 * Clone this node recursively.
+	 * If a node `from` contained in `replacements` is encountered, replace it with the associated node. If this is a nullptr, remove it instead.
+	 * @param replacements Map from nodes to replace to the nodes to replace with.
+	 * @return Cloned node.
+	 */
+	Node clone(const std::map<const Node*, const Node*>& replacements) const {
+		auto it = replacements.find(this);
+		if (it != replacements.end()) return *it->second;
+		std::vector<Node> newChildren;
+		for (const auto& c: children) {
+			it = replacements.find(&c);
+			if (it != replacements.end()) {
+				if (it->second != nullptr) newChildren.push_back(*it->second);
+			} else {
+				newChildren.push_back(c.clone(replacements));
+			}
+		}
+		return Node(std::make_tuple(name, newChildren, brackets));
+	}
+
 	/**
 	 * Clone this node recursively.
 	 * If a node with name `from` without children is enountered, replace it with `to`.
@@ -171,7 +193,7 @@ struct Node {
 		collectNames(names);
 		for (auto it = children.begin(); it != children.end(); ) {
 			if (it->name == "declare-fun") {
-				if (names.count(it->children[0].name) == 0) {
+				if (it->children.empty() || names.count(it->children[0].name) == 0) {
 					children.erase(it);
 					continue;
 				}
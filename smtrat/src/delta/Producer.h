@@ -42,7 +42,7 @@ public:
 	 * @param settings Settings object.
 	 */
 	Producer(const Checker& checker, const Settings& settings):
-		consumer(settings.as<std::string>("temp-file"), checker), settings(settings), interrupted(false)
+		consumer(settings.as<std::string>("temp-file"), checker, settings.as<std::size_t>("jobs"), settings.as<std::size_t>("batch")), settings(settings), interrupted(false)
 	{
 		if (!settings.has("no-constants")) operators.emplace_back(&constant, "Replaced variable ", " by constant ", ".");
 		if (!settings.has("no-children")) operators.emplace_back(&children, "Replaced ", " by child ", ".");
@@ -79,7 +79,7 @@ public:
 			} else {
 				while (!consumer.wait());
 			}
-			if (consumer.hasResult()) {
+			if (consumer.hasAnyResult()) {
 				auto r = consumer.getResult();
 				root = std::get<0>(r);
 				skip = std::get<2>(r); // skip until this node
@@ -156,12 +156,12 @@ private:
 			if (n.name == "declare-fun") return;
 		}
 		if (!settings.has("no-removal")) {
-			consumer.consume(root.clone(&n, nullptr), String() << "Removed \"" << n.repr(verbose) << "\"", num);
+			consumer.consume(root, &n, nullptr, String() << "Removed \"" << n.repr(verbose) << "\"", num);
 		}
 		for (const auto& op: operators) {
 			auto changes = std::get<0>(op)(n);
 			for (const auto& c: changes) {
-				consumer.consume(root.clone(&n, &c), String() << std::get<1>(op) << "\"" << n.repr(verbose) << "\"" << std::get<2>(op) << "\"" << c.repr(verbose) << "\"" << std::get<3>(op), num);
+				consumer.consume(root, &n, &c, String() << std::get<1>(op) << "\"" << n.repr(verbose) << "\"" << std::get<2>(op) << "\"" << c.repr(verbose) << "\"" << std::get<3>(op), num);
 			}
 		}
 	}
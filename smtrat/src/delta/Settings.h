@@ -5,8 +5,10 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cassert>
 #include <iostream>
+#include <thread>
 
 #include "../cli/config.h"
 #ifdef __VS
@@ -52,6 +54,8 @@ public:
 			("dfs,d", "use DFS instead of BFS")
 			("delay-declare-fun", bpo::value<bool>()->default_value(true), "delay removal of declare-fun")
 			("temp-file,T", bpo::value<std::string>()->default_value(".delta.smt2"), "temporary filename")
+			("jobs,j", bpo::value<std::size_t>()->default_value(std::max(std::thread::hardware_concurrency(), 1u)), "number of solver calls to run concurrently")
+			("batch,b", bpo::value<std::size_t>()->default_value(std::max(std::thread::hardware_concurrency(), 1u)), "number of successful reductions to collect and combine per iteration")
 		;
 		bpo::options_description operators("Node operators");
 		operators.add_options()
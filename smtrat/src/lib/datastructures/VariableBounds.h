@@ -378,6 +378,26 @@ namespace smtrat
                 ConstraintsT mNonBoundConstraints;
                 /// Stores deductions which this variable bounds manager has detected.
                 mutable std::unordered_set<std::vector<ConstraintT>> mBoundDeductions;
+                /// The variables whose stored exact intervals might be outdated, hence only these have to be updated.
+                mutable carl::Variables mOutdatedExactIntervals;
+                /// The variables whose stored double intervals might be outdated, hence only these have to be updated.
+                mutable carl::Variables mOutdatedDoubleIntervals;
+
+                /**
+                 * @param _var An arithmetic variable.
+                 * @return The variable object storing the bounds of the given variable, which is created if it does not exist.
+                 */
+                Variable<T>* addVariable( const carl::Variable& _var ) const;
+
+                /**
+                 * Updates the infimum and supremum of the given variable and records that its stored intervals are outdated.
+                 * @param _var The arithmetic variable.
+                 * @param _variable The variable object storing the bounds of the given variable.
+                 * @param _changedBound The bound, for which we certainly know that it got (de)activated before.
+                 * @return true, if there is a conflict;
+                 *          false, otherwise.
+                 */
+                bool updateBounds( const carl::Variable& _var, Variable<T>& _variable, const Bound<T>& _changedBound );
             public:
                 /**
                  * Constructs a variable bounds manager.
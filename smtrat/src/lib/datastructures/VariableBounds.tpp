@@ -283,7 +283,9 @@ namespace smtrat
             mpConstraintBoundMap( new ConstraintBoundMap() ),
             mEvalIntervalMap(),
             mDoubleIntervalMap(),
-            mBoundDeductions()
+            mBoundDeductions(),
+            mOutdatedExactIntervals(),
+            mOutdatedDoubleIntervals()
         {}
 
 		
@@ -314,6 +316,30 @@ namespace smtrat
             mBoundDeductions.clear();
             mDoubleIntervalMap.clear();
             mEvalIntervalMap.clear();
+            mOutdatedExactIntervals.clear();
+            mOutdatedDoubleIntervals.clear();
+        }
+
+        template<typename T>
+        Variable<T>* VariableBounds<T>::addVariable( const carl::Variable& _var ) const
+        {
+            typename VariableMap::iterator varVarPair = mpVariableMap->find( _var );
+            if( varVarPair != mpVariableMap->end() )
+                return varVarPair->second;
+            Variable<T>* variable = new Variable<T>();
+            mpVariableMap->emplace( _var, variable );
+            // The intervals of a new variable have not been stored yet.
+            mOutdatedExactIntervals.insert( _var );
+            mOutdatedDoubleIntervals.insert( _var );
+            return variable;
+        }
+
+        template<typename T>
+        bool VariableBounds<T>::updateBounds( const carl::Variable& _var, Variable<T>& _variable, const Bound<T>& _changedBound )
+        {
+            mOutdatedExactIntervals.insert( _var );
+            mOutdatedDoubleIntervals.insert( _var );
+            return _variable.updateBounds( _changedBound );
         }
 		
         template<typename T>
@@ -330,28 +356,16 @@ namespace smtrat
                         const Bound<T>& bound = *cbPair->second;
                         if( bound.activate( _origin ) )
                         {
-                            if( bound.pVariable()->updateBounds( bound ) )
+                            if( updateBounds( var, *bound.pVariable(), bound ) )
                                 mpConflictingVariable = bound.pVariable();
                         }
                     }
                     else
                     {
-                        Variable<T>* variable;
-                        const Bound<T>* bound;
-                        typename VariableBounds<T>::VariableMap::iterator evPair = mpVariableMap->find( var );
-                        if( evPair != mpVariableMap->end() )
-                        {
-                            variable = evPair->second;
-                            bound = variable->addBound( _constraint, evPair->first, _origin );
-                        }
-                        else
-                        {
-                            variable = new Variable<T>();
-                            (*mpVariableMap)[var] = variable;
-                            bound = variable->addBound( _constraint, var, _origin );
-                        }
+                        Variable<T>* variable = addVariable( var );
+                        const Bound<T>* bound = variable->addBound( _constraint, var, _origin );
                         mpConstraintBoundMap->insert( std::pair< ConstraintT, const Bound<T>* >( _constraint, bound ) );
-                        if( variable->updateBounds( *bound ) )
+                        if( updateBounds( var, *variable, *bound ) )
                             mpConflictingVariable = bound->pVariable();
                     }
                     return true;
@@ -361,22 +375,14 @@ namespace smtrat
                     if( mNonBoundConstraints.insert( _constraint ).second )
                     {
                         for( auto sym = _constraint.variables().begin(); sym !=  _constraint.variables().end(); ++sym )
-                        {
-                            Variable<T>* variable = new Variable<T>();
-                            if( !mpVariableMap->insert( std::pair< const carl::Variable, Variable<T>* >( *sym, variable ) ).second )
-                                delete variable;
-                        }
+                            addVariable( *sym );
                     }
                 }
             }
             else
             {
                 for( auto sym = _constraint.variables().begin(); sym !=  _constraint.variables().end(); ++sym )
-                {
-                    Variable<T>* variable = new Variable<T>();
-                    if( !mpVariableMap->insert( std::pair< const carl::Variable, Variable<T>* >( *sym, variable ) ).second )
-                        delete variable;
-                }
+                    addVariable( *sym );
             }
             return false;
         }
@@ -417,7 +423,7 @@ namespace smtrat
                     const Bound<T>& bound = *(*mpConstraintBoundMap)[_constraint];
                     if( bound.deactivate( _origin ) )
                     {
-                        if( bound.pVariable()->updateBounds( bound ) )
+                        if( updateBounds( var, *bound.pVariable(), bound ) )
                             mpConflictingVariable = bound.pVariable();
                         else
                             mpConflictingVariable = NULL;
@@ -445,7 +451,7 @@ namespace smtrat
                     const Bound<T>& bound = *(*mpConstraintBoundMap)[_constraint];
                     if( bound.deactivate( _origin ) )
                     {
-                        if( bound.pVariable()->updateBounds( bound ) )
+                        if( updateBounds( var, *bound.pVariable(), bound ) )
                             mpConflictingVariable = bound.pVariable();
                         else
                             mpConflictingVariable = NULL;
@@ -492,9 +498,9 @@ namespace smtrat
         const smtrat::EvalRationalIntervalMap& VariableBounds<T>::getEvalIntervalMap() const
         {
             assert( mpConflictingVariable == NULL );
-            for( auto varVarPair = mpVariableMap->begin(); varVarPair != mpVariableMap->end(); ++varVarPair )
+            for( const carl::Variable& arithVar : mOutdatedExactIntervals )
             {
-                Variable<T>& var = *varVarPair->second;
+                Variable<T>& var = *mpVariableMap->at( arithVar );
                 if( var.updatedExactInterval() )
                 {
                     carl::BoundType lowerBoundType;
@@ -521,10 +527,11 @@ namespace smtrat
                         upperBoundType = CONVERT_BOUND( var.supremum().type(), carl::BoundType );
                         upperBoundValue = var.supremum().limit();
                     }
-                    mEvalIntervalMap[varVarPair->first] = RationalInterval( lowerBoundValue, lowerBoundType, upperBoundValue, upperBoundType );
+                    mEvalIntervalMap[arithVar] = RationalInterval( lowerBoundValue, lowerBoundType, upperBoundValue, upperBoundType );
                     var.exactIntervalHasBeenUpdated();
                 }
             }
+            mOutdatedExactIntervals.clear();
             return mEvalIntervalMap;
         }
 		
@@ -602,9 +609,9 @@ namespace smtrat
         const smtrat::EvalDoubleIntervalMap& VariableBounds<T>::getIntervalMap() const
         {
             assert( mpConflictingVariable == NULL );
-            for( auto varVarPair = mpVariableMap->begin(); varVarPair != mpVariableMap->end(); ++varVarPair )
+            for( const carl::Variable& arithVar : mOutdatedDoubleIntervals )
             {
-                Variable<T>& var = *varVarPair->second;
+                Variable<T>& var = *mpVariableMap->at( arithVar );
                 if( var.updatedDoubleInterval() )
                 {
                     carl::BoundType lowerBoundType;
@@ -631,10 +638,11 @@ namespace smtrat
                         upperBoundType = CONVERT_BOUND( var.supremum().type(), carl::BoundType );
                         upperBoundValue = var.supremum().limit();
                     }
-                    mDoubleIntervalMap[varVarPair->first] = carl::Interval<double>( lowerBoundValue, lowerBoundType, upperBoundValue, upperBoundType );
+                    mDoubleIntervalMap[arithVar] = carl::Interval<double>( lowerBoundValue, lowerBoundType, upperBoundValue, upperBoundType );
                     var.doubleIntervalHasBeenUpdated();
                 }
             }
+            mOutdatedDoubleIntervals.clear();
             return mDoubleIntervalMap;
         }
 
@@ -25,6 +25,8 @@ namespace cad {
 		CADConstraints<Settings::backtracking> mConstraints;
 		ProjectionT<Settings> mProjection;
 		LiftingTree<Settings> mLifting;
+		/// Flags that signal that the computation should be aborted.
+		Conditionals mInterrupts;
 		
 		// ID scheme for variables x,y,z:
 		// Projection: x=1,y=2,z=3
@@ -77,6 +79,15 @@ namespace cad {
 		const auto& getBounds() const {
 			return mConstraints.bounds();
 		}
+		void setInterrupts(const Conditionals& interrupts) {
+			mInterrupts = interrupts;
+		}
+		bool interrupted() const {
+			for (const auto& i: mInterrupts) {
+				if (i->load()) return true;
+			}
+			return false;
+		}
 		void reset(const Variables& vars) {
 			mVariables = vars;
 			mConstraints.reset(mVariables);
@@ -97,6 +108,29 @@ namespace cad {
 			SMTRAT_LOG_DEBUG("smtrat.cad", "Current sampletree:" << std::endl << mLifting.getTree());
 		}
 		
+		/**
+		 * Lifts the sample with the given polynomial.
+		 * If multiple workers are used and parallelForUsesThreads, the sample is lifted with all polynomials that are available for it at once, such that their roots can be isolated concurrently.
+		 * Polynomials that were not used due to an interrupt are left for later.
+		 */
+		template<typename Iterator>
+		void liftSample(Iterator& it, const UPoly& poly, std::size_t polyID) {
+			if (!parallelForUsesThreads || Settings::workers <= 1) {
+				mLifting.liftSample(it, poly, polyID);
+				return;
+			}
+			std::size_t level = idLP(it.depth() + 1);
+			std::vector<std::pair<const UPoly*,std::size_t>> polys = {{&poly, polyID}};
+			while (auto id = mProjection.getPolyForLifting(level, it->liftedWith())) {
+				polys.emplace_back(&mProjection.getPolynomialById(level, *id), *id);
+			}
+			std::size_t lifted = mLifting.liftSample(it, polys, [this](){ return interrupted(); });
+			// Adding the new samples may have moved the sample itself.
+			for (std::size_t i = lifted; i < polys.size(); i++) {
+				it->liftedWith().reset(polys[i].second);
+			}
+		}
+		
 		template<typename ConstraintIt>
 		bool evaluateSample(Sample& sample, const ConstraintIt& constraint, Assignment& assignment) const {
 			std::size_t cid = constraint.second;
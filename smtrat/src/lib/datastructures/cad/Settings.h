@@ -18,6 +18,9 @@ namespace cad {
 		static constexpr Backtracking backtracking = Backtracking::ORDERED;
 		
 		static constexpr ProjectionType projectionOperator = cad::ProjectionType::Brown;
+		static constexpr bool projectionCache = true;
+		/// Number of threads used to project pairs of polynomials and to isolate roots while lifting. Only used with SMTRAT_STRAT_PARALLEL_MODE if carl is built with THREAD_SAFE.
+		static constexpr std::size_t workers = 1;
 		static constexpr CoreHeuristic coreHeuristic = cad::CoreHeuristic::PreferProjection;
 		
 		static constexpr MISHeuristic misHeuristic = cad::MISHeuristic::GREEDY;
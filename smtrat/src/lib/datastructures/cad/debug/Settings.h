@@ -12,6 +12,8 @@ namespace debug {
 		static constexpr Backtracking backtracking = Backtracking::ORDERED;
 		
 		static constexpr ProjectionType projectionOperator = cad::ProjectionType::Brown;
+		static constexpr bool projectionCache = true;
+		static constexpr std::size_t workers = 1;
 		static constexpr CoreHeuristic coreHeuristic = cad::CoreHeuristic::PreferProjection;
 		
 		static constexpr MISHeuristic misHeuristic = cad::MISHeuristic::GREEDY;
@@ -15,6 +15,7 @@ struct CADCore<CoreHeuristic::BySample> {
 		cad.mLifting.resetFullSamples();
 		cad.mLifting.restoreRemovedSamples();
 		while (true) {
+			if (cad.interrupted()) return Answer::ABORTED;
 			SMTRAT_LOG_DEBUG("smtrat.cad", "Current sample tree:" << std::endl << cad.mLifting.getTree());
 			SMTRAT_LOG_DEBUG("smtrat.cad", "Current sample queue:" << std::endl << cad.mLifting.getLiftingQueue());
 			Answer res = cad.checkFullSamples(assignment);
@@ -38,7 +39,7 @@ struct CADCore<CoreHeuristic::BySample> {
 			if (polyID) {
 				const auto& poly = cad.mProjection.getPolynomialById(cad.idLP(it.depth() + 1), *polyID);
 				SMTRAT_LOG_DEBUG("smtrat.cad", "Lifting " << s << " with " << poly);
-				cad.mLifting.liftSample(it, poly, *polyID);
+				cad.liftSample(it, poly, *polyID);
 			} else {
 				cad.mLifting.removeNextSample();
 				if (!cad.mLifting.hasNextSample()) {
@@ -62,6 +63,7 @@ struct CADCore<CoreHeuristic::PreferProjection> {
 		cad.mLifting.resetFullSamples();
 		cad.mLifting.restoreRemovedSamples();
 		while (true) {
+			if (cad.interrupted()) return Answer::ABORTED;
 			Answer res = cad.checkFullSamples(assignment);
 			if (res == Answer::SAT) return Answer::SAT;
 			
@@ -82,7 +84,7 @@ struct CADCore<CoreHeuristic::PreferProjection> {
 			if (polyID) {
 				const auto& poly = cad.mProjection.getPolynomialById(cad.idLP(it.depth() + 1), *polyID);
 				SMTRAT_LOG_DEBUG("smtrat.cad", "Lifting " << s << " with " << poly);
-				cad.mLifting.liftSample(it, poly, *polyID);
+				cad.liftSample(it, poly, *polyID);
 			} else {
 				SMTRAT_LOG_DEBUG("smtrat.cad", "Got no polynomial for " << s << ", projecting into level " << cad.idLP(it.depth() + 1) << " ...");
 				SMTRAT_LOG_DEBUG("smtrat.cad", "Current projection:" << std::endl << cad.mProjection);
@@ -110,6 +112,7 @@ struct CADCore<CoreHeuristic::PreferSampling> {
 		while (true) {
 			cad.mLifting.restoreRemovedSamples();
 			while (cad.mLifting.hasNextSample() || cad.mLifting.hasFullSamples()) {
+				if (cad.interrupted()) return Answer::ABORTED;
 				//SMTRAT_LOG_INFO("smtrat.cad", "Current Projection:" << std::endl << cad.mProjection);
 				//SMTRAT_LOG_INFO("smtrat.cad", "Current lifting" << std::endl << cad.mLifting.getTree());
 				Answer res = cad.checkFullSamples(assignment);
@@ -129,7 +132,7 @@ struct CADCore<CoreHeuristic::PreferSampling> {
 				if (polyID) {
 					const auto& poly = cad.mProjection.getPolynomialById(cad.idLP(it.depth() + 1), *polyID);
 					SMTRAT_LOG_DEBUG("smtrat.cad", "Lifting " << cad.mLifting.extractSampleMap(it) << " with " << poly);
-					cad.mLifting.liftSample(it, poly, *polyID);
+					cad.liftSample(it, poly, *polyID);
 				} else {
 					SMTRAT_LOG_DEBUG("smtrat.cad", "Current lifting" << std::endl << cad.mLifting.getTree());
 					SMTRAT_LOG_TRACE("smtrat.cad", "Queue" << std::endl << cad.mLifting.getLiftingQueue());
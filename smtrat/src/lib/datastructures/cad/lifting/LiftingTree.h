@@ -3,6 +3,7 @@
 #include <carl/util/carlTree.h>
 
 #include "../Common.h"
+#include "../utils/ParallelFor.h"
 
 #include "LiftingOperator.h"
 #include "SampleIteratorQueue.h"
@@ -57,13 +58,14 @@ namespace cad {
 			auto tend = mTree.end_children(parent);
 			// Insert roots
 			for (const auto& s: samples) {
-				while (tit != tend && *tit < s) tit++;
+				int cmp = 1;
+				while (tit != tend && (cmp = compareRAN(tit->value(), s.value())) < 0) tit++;
 				if (tit == tend) {
 					// Append as last sample
 					auto it = mTree.append(parent, s);
 					addToQueue(it);
 					gotNewSamples = true;
-				} else if (tit->value() == s.value()) {
+				} else if (cmp == 0) {
 					// Replace non-root sample
 					if (!tit->isRoot()) gotNewSamples = true;
 					tit->merge(s);
@@ -169,11 +171,9 @@ namespace cad {
 			mRemovedFromLiftingQueue.clear();
 		}
 		
-		bool liftSample(Iterator sample, const UPoly& p, std::size_t pid) {
-			assert(isConsistent());
-			auto m = extractSampleMap(sample);
+		/// Isolates the real roots of p over the given sample.
+		std::list<RAN> isolateRoots(const Assignment& m, const UPoly& p) const {
 			SMTRAT_LOG_DEBUG("smtrat.cad.lifting", "Lifting " << m << " on " << p);
-			std::vector<Sample> newSamples;
 			// TODO: Check whether the polynomials becomes zero (check if McCallum is safe)
 			auto roots = carl::rootfinder::realRoots(p, m, RationalInterval::unboundedInterval(), Settings::rootSplittingStrategy);
 			std::list<RAN> rootlist = { RAN(0) };
@@ -181,6 +181,54 @@ namespace cad {
 			else {
 				// Here, the polynomial vanished.
 			}
+			return rootlist;
+		}
+		
+		bool liftSample(Iterator sample, const UPoly& p, std::size_t pid) {
+			assert(isConsistent());
+			return mergeRoots(sample, isolateRoots(extractSampleMap(sample), p), pid);
+		}
+		/**
+		 * Lifts the sample with all the given polynomials and their ids.
+		 * The roots are isolated on Settings::workers threads if parallelForUsesThreads and merged in the given order afterwards.
+		 * No further roots are isolated once stop() returns true, such that the sample is only lifted with a prefix of the polynomials.
+		 * @return The number of polynomials the sample has been lifted with.
+		 */
+		template<typename Stop>
+		std::size_t liftSample(Iterator sample, const std::vector<std::pair<const UPoly*,std::size_t>>& polys, Stop&& stop) {
+			assert(isConsistent());
+			// Copies of an algebraic number share their isolating interval, hence every task refines its own copy.
+			auto m = extractSampleMap(sample);
+			std::vector<Assignment> maps;
+			for (std::size_t i = 0; i < polys.size(); i++) {
+				maps.emplace_back();
+				for (const auto& a: m) {
+					if (a.second.isInterval()) {
+						maps.back().emplace(a.first, RAN(a.second.getIRPolynomial(), a.second.getInterval(), a.second.isRoot()));
+					} else {
+						maps.back().emplace(a.first, a.second);
+					}
+				}
+			}
+			std::vector<std::list<RAN>> roots(polys.size());
+			std::vector<char> done(polys.size(), 0);
+			parallelFor(polys.size(), Settings::workers,
+				[&](std::size_t i){
+					roots[i] = isolateRoots(maps[i], *polys[i].first);
+					done[i] = 1;
+				},
+				stop
+			);
+			std::size_t lifted = 0;
+			while (lifted < polys.size() && done[lifted]) {
+				mergeRoots(sample, roots[lifted], polys[lifted].second);
+				lifted++;
+			}
+			return lifted;
+		}
+		/// Merges the roots of the polynomial with the given id and the bounds into the children of the sample.
+		bool mergeRoots(Iterator sample, const std::list<RAN>& rootlist, std::size_t pid) {
+			std::vector<Sample> newSamples;
 			for (const auto& r: rootlist) {
 				SMTRAT_LOG_DEBUG("smtrat.cad.lifting", "\tnew root sample: " << r);
 				newSamples.emplace_back(r, pid);
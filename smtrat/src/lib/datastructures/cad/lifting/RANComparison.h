@@ -0,0 +1,73 @@
+#pragma once
+
+#include <atomic>
+
+#include <carl/formula/model/ran/RealAlgebraicNumberComparison.h>
+
+#include "../Common.h"
+
+namespace smtrat {
+namespace cad {
+
+	/**
+	 * Counts how many comparisons of algebraic numbers were decided by each tier of compareRAN().
+	 * The counters are shared by all modules and may be incremented by parallel lifting, hence they are atomic.
+	 */
+	struct RANComparisonCounters {
+		/// Both numbers were numeric.
+		std::atomic<std::size_t> numeric;
+		/// The double approximations of the isolating intervals were separated.
+		std::atomic<std::size_t> approximation;
+		/// The isolating intervals were separated, possibly after a few bisections.
+		std::atomic<std::size_t> interval;
+		/// An exact comparison was necessary.
+		std::atomic<std::size_t> exact;
+
+		RANComparisonCounters(): numeric(0), approximation(0), interval(0), exact(0) {}
+
+		static void count(std::atomic<std::size_t>& counter) {
+			counter.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		static RANComparisonCounters& getInstance() {
+			static RANComparisonCounters counters;
+			return counters;
+		}
+	};
+
+	namespace ran_comparison {
+		/// Checks whether the number is known to be non-negative (or non-positive) without any refinement.
+		inline bool hasSign(const RAN& r, bool positive) {
+			if (r.isNumeric()) return positive ? r.value() >= 0 : r.value() <= 0;
+			carl::Sign s = r.sgn();
+			if (r.isInterval() && s == carl::Sign::ZERO) return false;
+			return positive ? s != carl::Sign::NEGATIVE : s != carl::Sign::POSITIVE;
+		}
+	}
+
+	/**
+	 * Compares two algebraic numbers and returns -1, 0 or 1 if lhs is smaller, equal or larger than rhs.
+	 * The comparison is done by carl::compare(), which tries cheap tests first, and the deciding tier is counted.
+	 */
+	inline int compareRAN(const RAN& lhs, const RAN& rhs) {
+		auto& counters = RANComparisonCounters::getInstance();
+		carl::RANComparisonTier tier;
+		int res = carl::compare(lhs, rhs, tier);
+		switch (tier) {
+			case carl::RANComparisonTier::Numeric: RANComparisonCounters::count(counters.numeric); break;
+			case carl::RANComparisonTier::Approximation: RANComparisonCounters::count(counters.approximation); break;
+			case carl::RANComparisonTier::Interval: RANComparisonCounters::count(counters.interval); break;
+			case carl::RANComparisonTier::Exact: RANComparisonCounters::count(counters.exact); break;
+		}
+		return res;
+	}
+
+	/// Compares the absolute values of two algebraic numbers like compareRAN() without constructing them if the signs are known.
+	inline int compareRANAbs(const RAN& lhs, const RAN& rhs) {
+		using ran_comparison::hasSign;
+		if (hasSign(lhs, true) && hasSign(rhs, true)) return compareRAN(lhs, rhs);
+		if (hasSign(lhs, false) && hasSign(rhs, false)) return compareRAN(rhs, lhs);
+		return compareRAN(lhs.abs(), rhs.abs());
+	}
+}
+}
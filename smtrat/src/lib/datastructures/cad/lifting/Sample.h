@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../Common.h"
+#include "RANComparison.h"
 
 #include <iostream>
 #include <limits>
@@ -80,13 +81,13 @@ namespace cad {
 		}
 		
 		bool operator<(const Sample& s) const {
-			return value() < s.value();
+			return compareRAN(value(), s.value()) < 0;
 		}
 		bool operator>(const Sample& s) const {
-			return s.value() < value();
+			return compareRAN(value(), s.value()) > 0;
 		}
 		bool operator==(const Sample& s) const {
-			return value() == s.value();
+			return compareRAN(value(), s.value()) == 0;
 		}
 		
 		friend std::ostream& operator<<(std::ostream& os, const Sample& s) {
@@ -18,8 +18,9 @@ namespace cad {
 				SMTRAT_LOG_TRACE("smtrat.cad.lifting", lhs->value() << " < " << rhs->value() << ": Size (" << lsize << " / " << rsize << ") " << (lsize > rsize));
 				return lsize > rsize;
 			}
-			SMTRAT_LOG_TRACE("smtrat.cad.lifting", lhs->value() << " < " << rhs->value() << ": Absolute " << (lhs->value().abs() > rhs->value().abs()));
-			return lhs->value().abs() > rhs->value().abs();
+			int cmp = compareRANAbs(lhs->value(), rhs->value());
+			SMTRAT_LOG_TRACE("smtrat.cad.lifting", lhs->value() << " < " << rhs->value() << ": Absolute " << (cmp > 0));
+			return cmp > 0;
 		}
 	};
 	
@@ -7,6 +7,7 @@
 
 #include "../Common.h"
 #include "../helper/CADConstraints.h"
+#include "../utils/ParallelFor.h"
 
 #include "ProjectionOperator.h"
 #include "PolynomialLiftingQueue.h"
@@ -31,7 +32,7 @@ namespace cad {
 		/// Callback to be called when polynomials are removed. The arguments are the projection level and a bitset that indicate which polynomials were removed in this level.
 		std::function<void(std::size_t, const SampleLiftedWith&)> mRemoveCallback;
 		
-		BaseProjection(const Constraints& c): mConstraints(c) {}
+		BaseProjection(const Constraints& c): mConstraints(c), mOperator(Settings::projectionCache) {}
 		
 		void callRemoveCallback(std::size_t level, const SampleLiftedWith& slw) const {
 			if (mRemoveCallback) mRemoveCallback(level, slw);
@@ -51,6 +52,29 @@ namespace cad {
 			assert(level > 0 && level <= dim());
 			return vars()[level - 1];
 		}
+		/**
+		 * Projects p paired with each of the given polynomials into the given variable and calls cb(i, np) for every polynomial np resulting from p and others[i].
+		 * The pairs are projected on Settings::workers threads if parallelForUsesThreads, but the callback is called in the same order as for a sequential projection.
+		 */
+		template<typename Callback>
+		void projectPairs(const UPoly& p, const std::vector<const UPoly*>& others, carl::Variable::Arg variable, Callback&& cb) const {
+			if (!parallelForUsesThreads || Settings::workers <= 1 || others.size() <= 1) {
+				for (std::size_t i = 0; i < others.size(); i++) {
+					mOperator(Settings::projectionOperator, p, *others[i], variable, [&](const UPoly& np){ cb(i, np); });
+				}
+				return;
+			}
+			std::vector<std::vector<UPoly>> results(others.size());
+			parallelFor(others.size(), Settings::workers,
+				[&](std::size_t i){
+					mOperator(Settings::projectionOperator, p, *others[i], variable, [&](const UPoly& np){ results[i].push_back(np); });
+				},
+				[](){ return false; }
+			);
+			for (std::size_t i = 0; i < results.size(); i++) {
+				for (const auto& np: results[i]) cb(i, np);
+			}
+		}
 		/// Checks whether a polynomial can safely be ignored.
 		bool canBeRemoved(const UPoly& p) const {
 			return p.isZero() || p.isNumber();
@@ -126,6 +150,10 @@ namespace cad {
 		UPoly normalize(const UPoly& p) const {
 			return mOperator.normalize(p);
 		}
+		/// Returns the projection operator, which counts its accesses to the ProjectionCache.
+		const ProjectionOperator& projectionOperator() const {
+			return mOperator;
+		}
 		
 		/// Get a polynomial from this level suited for lifting.
 		OptionalID getPolyForLifting(std::size_t level, SampleLiftedWith& slw) {
@@ -0,0 +1,142 @@
+#pragma once
+
+#include <deque>
+#include <unordered_map>
+#include <utility>
+
+#include <carl/config.h>
+#include <carl/util/hash.h>
+
+#include "../../../config.h"
+#include "../Common.h"
+
+#ifdef SMTRAT_STRAT_PARALLEL_MODE
+#include <mutex>
+#endif
+
+namespace smtrat {
+namespace cad {
+
+	/**
+	 * Global cache for the expensive parts of the projection operators.
+	 *
+	 * The same polynomials are projected over and over again, e.g. when constraints are removed and added again between two calls to check or by different instances of the CAD.
+	 * Hence this cache stores (normalized) resultants, discriminants and normalizations of polynomials, identified by the polynomials and the variable of the result.
+	 * As resultants are only used after normalization, they are stored normalized and symmetric in both arguments.
+	 * If the cache is full, the oldest entries are dropped.
+	 * With SMTRAT_STRAT_PARALLEL_MODE the cache can be used from multiple threads.
+	 * The results are only computed without holding the lock if carl is built with THREAD_SAFE, as the computation uses the pools of carl.
+	 * The hits and misses are counted by the callers, such that every module reports its own.
+	 */
+	class ProjectionCache {
+	public:
+		enum class Kind { Resultant, Discriminant, Normalization };
+	private:
+		struct Key {
+			Kind kind;
+			UPoly p;
+			UPoly q;
+			carl::Variable variable;
+			bool operator==(const Key& k) const {
+				return kind == k.kind && variable == k.variable && p.mainVar() == k.p.mainVar() && q.mainVar() == k.q.mainVar() && p == k.p && q == k.q;
+			}
+		};
+		struct KeyHash {
+			std::size_t operator()(const Key& k) const {
+				return carl::hash_all(static_cast<std::size_t>(k.kind), k.variable, k.p.mainVar(), k.p, k.q);
+			}
+		};
+		using Map = std::unordered_map<Key, UPoly, KeyHash>;
+
+		/// Maximal number of entries, zero means no limit.
+		std::size_t mCapacity;
+		Map mEntries;
+		/// Keys of the entries in order of their insertion.
+		std::deque<const Key*> mInsertionOrder;
+#ifdef SMTRAT_STRAT_PARALLEL_MODE
+		/// Recursive, as computing a resultant normalizes it using this cache.
+		mutable std::recursive_mutex mMutex;
+#endif
+
+		explicit ProjectionCache(std::size_t capacity): mCapacity(capacity) {}
+
+		template<typename F>
+		UPoly get(Key&& key, F&& compute, bool& hit) {
+#ifdef SMTRAT_STRAT_PARALLEL_MODE
+			std::unique_lock<std::recursive_mutex> lock(mMutex);
+#endif
+			auto found = mEntries.find(key);
+			hit = found != mEntries.end();
+			if (hit) return found->second;
+#if defined SMTRAT_STRAT_PARALLEL_MODE && defined THREAD_SAFE
+			lock.unlock();
+#endif
+			UPoly res = compute();
+#if defined SMTRAT_STRAT_PARALLEL_MODE && defined THREAD_SAFE
+			lock.lock();
+#endif
+			auto it = mEntries.emplace(std::move(key), res);
+			if (it.second) {
+				mInsertionOrder.push_back(&it.first->first);
+				while (mCapacity > 0 && mEntries.size() > mCapacity) {
+					mEntries.erase(mEntries.find(*mInsertionOrder.front()));
+					mInsertionOrder.pop_front();
+				}
+			}
+			return res;
+		}
+	public:
+		ProjectionCache(const ProjectionCache&) = delete;
+		ProjectionCache& operator=(const ProjectionCache&) = delete;
+
+		/// Returns the global instance. It is never destroyed, as it may be used while static objects are destroyed.
+		static ProjectionCache& getInstance() {
+			static ProjectionCache* instance = new ProjectionCache(100000);
+			return *instance;
+		}
+
+		/// Returns normalize(p.resultant(q).switchVariable(variable)) as computed by compute, hit is set if it was cached.
+		template<typename F>
+		UPoly resultant(const UPoly& p, const UPoly& q, carl::Variable::Arg variable, F&& compute, bool& hit) {
+			if (q < p) return get(Key{Kind::Resultant, q, p, variable}, compute, hit);
+			return get(Key{Kind::Resultant, p, q, variable}, compute, hit);
+		}
+		/// Returns p.discriminant().switchVariable(variable) as computed by compute, hit is set if it was cached.
+		template<typename F>
+		UPoly discriminant(const UPoly& p, carl::Variable::Arg variable, F&& compute, bool& hit) {
+			return get(Key{Kind::Discriminant, p, p, variable}, compute, hit);
+		}
+		/// Returns the normalization of p as computed by compute, hit is set if it was cached.
+		template<typename F>
+		UPoly normalization(const UPoly& p, F&& compute, bool& hit) {
+			return get(Key{Kind::Normalization, p, p, p.mainVar()}, compute, hit);
+		}
+
+		/// Sets the maximal number of entries, zero means no limit.
+		void setCapacity(std::size_t capacity) {
+#ifdef SMTRAT_STRAT_PARALLEL_MODE
+			std::lock_guard<std::recursive_mutex> lock(mMutex);
+#endif
+			mCapacity = capacity;
+			while (mCapacity > 0 && mEntries.size() > mCapacity) {
+				mEntries.erase(mEntries.find(*mInsertionOrder.front()));
+				mInsertionOrder.pop_front();
+			}
+		}
+		void clear() {
+#ifdef SMTRAT_STRAT_PARALLEL_MODE
+			std::lock_guard<std::recursive_mutex> lock(mMutex);
+#endif
+			mInsertionOrder.clear();
+			mEntries.clear();
+		}
+		std::size_t size() const {
+#ifdef SMTRAT_STRAT_PARALLEL_MODE
+			std::lock_guard<std::recursive_mutex> lock(mMutex);
+#endif
+			return mEntries.size();
+		}
+	};
+
+}
+}
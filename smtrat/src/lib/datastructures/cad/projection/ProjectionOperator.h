@@ -1,11 +1,35 @@
 #pragma once
 
+#include <atomic>
+
 #include "../Common.h"
+#include "ProjectionCache.h"
 
 namespace smtrat {
 namespace cad {
 
     struct ProjectionOperator {
+		/// Whether resultants, discriminants and normalizations are taken from the global ProjectionCache.
+		bool mUseCache;
+		/// Number of results of this operator found in the cache. Atomic, as pairs may be projected in parallel.
+		mutable std::atomic<std::size_t> mCacheHits;
+		/// Number of results of this operator computed for the cache.
+		mutable std::atomic<std::size_t> mCacheMisses;
+		
+		explicit ProjectionOperator(bool useCache = false): mUseCache(useCache), mCacheHits(0), mCacheMisses(0) {}
+		ProjectionOperator(const ProjectionOperator& po): mUseCache(po.mUseCache), mCacheHits(po.mCacheHits.load()), mCacheMisses(po.mCacheMisses.load()) {}
+		
+		std::size_t cacheHits() const {
+			return mCacheHits;
+		}
+		std::size_t cacheMisses() const {
+			return mCacheMisses;
+		}
+		
+		void countCacheAccess(bool hit) const {
+			(hit ? mCacheHits : mCacheMisses).fetch_add(1, std::memory_order_relaxed);
+		}
+		
         template<typename Callback>
         void operator()(ProjectionType pt, const UPoly& p, carl::Variable::Arg variable, Callback&& cb) const {
             switch (pt) {
@@ -43,20 +67,45 @@ namespace cad {
         }
 		
 		UPoly normalize(const UPoly& p) const {
-			SMTRAT_LOG_DEBUG("smtrat.cad.projection", "Normalizing " << p << " to " << p.squareFreePart().pseudoPrimpart().normalized());
-			return p.squareFreePart().pseudoPrimpart().normalized();
+			auto compute = [&p](){
+				SMTRAT_LOG_DEBUG("smtrat.cad.projection", "Normalizing " << p << " to " << p.squareFreePart().pseudoPrimpart().normalized());
+				return p.squareFreePart().pseudoPrimpart().normalized();
+			};
+			if (!mUseCache) return compute();
+			bool hit;
+			UPoly res = ProjectionCache::getInstance().normalization(p, compute, hit);
+			countCacheAccess(hit);
+			return res;
+		}
+		/// Computes the normalized resultant of p and q in the given variable.
+		UPoly resultant(const UPoly& p, const UPoly& q, carl::Variable::Arg variable) const {
+			auto compute = [&](){ return normalize(p.resultant(q).switchVariable(variable)); };
+			if (!mUseCache) return compute();
+			bool hit;
+			UPoly res = ProjectionCache::getInstance().resultant(p, q, variable, compute, hit);
+			countCacheAccess(hit);
+			return res;
+		}
+		/// Computes the discriminant of p in the given variable.
+		UPoly discriminant(const UPoly& p, carl::Variable::Arg variable) const {
+			auto compute = [&](){ return p.discriminant().switchVariable(variable); };
+			if (!mUseCache) return compute();
+			bool hit;
+			UPoly res = ProjectionCache::getInstance().discriminant(p, variable, compute, hit);
+			countCacheAccess(hit);
+			return res;
 		}
 
 		template<typename Callback>
 		void Brown(const UPoly& p, const UPoly& q, carl::Variable::Arg variable, Callback& cb) const {
-			auto res = normalize(p.resultant(q).switchVariable(variable));
+			auto res = resultant(p, q, variable);
 			SMTRAT_LOG_DEBUG("smtrat.cad.projection", "resultant(" << p << ", " << q << ") = " << res);
 			cb(res);
 		}
 		template<typename Callback>
 		void Brown(const UPoly& p, carl::Variable::Arg variable, Callback& cb) const {
 			// Insert discriminant
-			auto dis = normalize(p.discriminant().switchVariable(variable));
+			auto dis = normalize(discriminant(p, variable));
 			SMTRAT_LOG_DEBUG("smtrat.cad.projection", "discriminant(" << p << ") = " << dis);
 			cb(dis);
 			if (doesNotVanish(p.lcoeff())) {
@@ -81,13 +130,13 @@ namespace cad {
         template<typename Callback>
         void McCallum(const UPoly& p, const UPoly& q, carl::Variable::Arg variable, Callback& cb) const {
 			SMTRAT_LOG_DEBUG("smtrat.cad.projection", "resultant(" << p << ", " << q << ")");
-            cb(normalize(p.resultant(q).switchVariable(variable)));
+            cb(resultant(p, q, variable));
         }
         template<typename Callback>
         void McCallum(const UPoly& p, carl::Variable::Arg variable, Callback& cb) const {
             // Insert discriminant
 			SMTRAT_LOG_DEBUG("smtrat.cad.projection", "discriminant(" << p << ")");
-            cb(p.discriminant().switchVariable(variable));
+            cb(discriminant(p, variable));
             for (const auto& coeff: p.coefficients()) {
 				if (coeff.isConstant()) continue;
 				SMTRAT_LOG_DEBUG("smtrat.cad.projection", "\t-> " << coeff);
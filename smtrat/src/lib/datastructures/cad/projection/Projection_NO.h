@@ -32,6 +32,7 @@ namespace cad {
 		using Super::callRemoveCallback;
 		using Super::canBeRemoved;
 		using Super::canBeForwarded;
+		using Super::projectPairs;
 		using Super::var;
 	public:
 		using Super::dim;
@@ -103,12 +104,11 @@ namespace cad {
 				mOperator(Settings::projectionOperator, p, var(level + 1), 
 					[&](const UPoly& np){ res |= addToProjection(level + 1, np, origin); }
 				);
-				for (const auto& it: polys(level)) {
-					std::size_t newOrigin = std::max(origin, it.second);
-					mOperator(Settings::projectionOperator, p, it.first, var(level + 1),
-						[&](const UPoly& np){ res |= addToProjection(level + 1, np, newOrigin); }
-					);
-				}
+				std::vector<const UPoly*> others;
+				for (const auto& it: polys(level)) others.push_back(&it.first);
+				projectPairs(p, others, var(level + 1),
+					[&](std::size_t i, const UPoly& np){ res |= addToProjection(level + 1, np, std::max(origin, polys(level)[i].second)); }
+				);
 			}
 			// Actually insert afterwards to avoid pairwise projection with itself.
 			insertPolynomial(level, p, origin);
@@ -26,6 +26,7 @@ namespace cad {
 		using Super::canBeRemoved;
 		using Super::getID;
 		using Super::freeID;
+		using Super::projectPairs;
 		using Super::var;
 	public:
 		using Super::dim;
@@ -73,13 +74,16 @@ namespace cad {
 				mOperator(Settings::projectionOperator, p, var(level + 1), 
 					[&](const UPoly& np){ res |= addToProjection(level + 1, np, Origin::BaseType(level, newID)); }
 				);
+				std::vector<const UPoly*> others;
+				std::vector<std::size_t> ids;
 				for (const auto& it: polyIDs(level)) {
 					assert(polys(level)[it.second]);
-					auto newOrigin = Origin::BaseType(level, newID, it.second);
-					mOperator(Settings::projectionOperator, p, it.first, var(level + 1),
-						[&](const UPoly& np){ res |= addToProjection(level + 1, np, newOrigin); }
-					);
+					others.push_back(&it.first);
+					ids.push_back(it.second);
 				}
+				projectPairs(p, others, var(level + 1),
+					[&](std::size_t i, const UPoly& np){ res |= addToProjection(level + 1, np, Origin::BaseType(level, newID, ids[i])); }
+				);
 			}
 			if (newID >= polys(level).size()) {
 				polys(level).resize(newID + 1);
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+#include <carl/config.h>
+#include "../../../config.h"
+
+#if defined SMTRAT_STRAT_PARALLEL_MODE && defined THREAD_SAFE
+#include <thread>
+#endif
+
+namespace smtrat {
+namespace cad {
+
+	/**
+	 * Whether parallelFor() uses threads.
+	 * The tasks create polynomials and algebraic numbers, whose pools in carl are only guarded if carl is built with THREAD_SAFE.
+	 */
+#if defined SMTRAT_STRAT_PARALLEL_MODE && defined THREAD_SAFE
+	static constexpr bool parallelForUsesThreads = true;
+#else
+	static constexpr bool parallelForUsesThreads = false;
+#endif
+
+	/**
+	 * Calls f(i) for all 0 <= i < n.
+	 * If parallelForUsesThreads, the calls are distributed to up to the given number of threads, otherwise they are performed one after another.
+	 * No new calls are started as soon as stop() returns true.
+	 * @return false, if some calls have been skipped as stop() returned true.
+	 */
+	template<typename F, typename Stop>
+	bool parallelFor(std::size_t n, std::size_t workers, F&& f, Stop&& stop) {
+		std::atomic<std::size_t> next(0);
+		std::atomic<bool> stopped(false);
+		auto work = [&](){
+			for (std::size_t i = next++; i < n; i = next++) {
+				if (stopped || stop()) {
+					stopped = true;
+					return;
+				}
+				f(i);
+			}
+		};
+#if defined SMTRAT_STRAT_PARALLEL_MODE && defined THREAD_SAFE
+		std::vector<std::thread> threads;
+		for (std::size_t i = 1; i < std::min(workers, n); i++) {
+			threads.emplace_back(work);
+		}
+		work();
+		for (auto& t: threads) t.join();
+#else
+		(void)workers;
+		work();
+#endif
+		return !stopped;
+	}
+
+}
+}
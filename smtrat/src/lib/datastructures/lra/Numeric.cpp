@@ -7,6 +7,7 @@
  */
 
 #include "Numeric.h"
+#include <limits>
 
 using namespace smtrat;
 using namespace std;
@@ -15,11 +16,104 @@ namespace smtrat
 {
     namespace lra
     {
+        namespace
+        {
+            /// The largest absolute value of the numerator and the denominator of an inline Numeric. The smallest long is
+            /// excluded, such that negations never overflow.
+            const long MAX_INLINE = numeric_limits<long>::max();
+
+            /**
+             * Adds the two given integers.
+             * @param _valueA The first summand.
+             * @param _valueB The second summand.
+             * @param _result The sum, if it does not overflow.
+             * @return false, if the sum overflows.
+             */
+            inline bool addChecked( long _valueA, long _valueB, long& _result )
+            {
+                #if defined(__GNUC__) || defined(__clang__)
+                return !__builtin_add_overflow( _valueA, _valueB, &_result ) && _result >= -MAX_INLINE;
+                #else
+                if( (_valueB > 0 && _valueA > MAX_INLINE - _valueB) || (_valueB < 0 && _valueA < -MAX_INLINE - _valueB) )
+                    return false;
+                _result = _valueA + _valueB;
+                return true;
+                #endif
+            }
+
+            /**
+             * Multiplies the two given integers.
+             * @param _valueA The first factor.
+             * @param _valueB The second factor.
+             * @param _result The product, if it does not overflow.
+             * @return false, if the product overflows.
+             */
+            inline bool mulChecked( long _valueA, long _valueB, long& _result )
+            {
+                #if defined(__GNUC__) || defined(__clang__)
+                return !__builtin_mul_overflow( _valueA, _valueB, &_result ) && _result >= -MAX_INLINE;
+                #else
+                if( _valueA != 0 && std::abs( _valueB ) > MAX_INLINE / std::abs( _valueA ) )
+                    return false;
+                _result = _valueA * _valueB;
+                return true;
+                #endif
+            }
+
+            /**
+             * @param _valueA An integer.
+             * @param _valueB An integer.
+             * @return The non-negative greatest common divisor of the given integers.
+             */
+            inline long gcdInline( long _valueA, long _valueB )
+            {
+                _valueA = std::abs( _valueA );
+                _valueB = std::abs( _valueB );
+                while( _valueB != 0 )
+                {
+                    long rest = _valueA % _valueB;
+                    _valueA = _valueB;
+                    _valueB = rest;
+                }
+                return _valueA;
+            }
+
+            /**
+             * Adds the two given fractions, whose denominators are positive.
+             * @return false, if an intermediate result overflows.
+             */
+            inline bool addFractions( long _numA, long _denA, long _numB, long _denB, long& _num, long& _den )
+            {
+                if( _denA == _denB )
+                {
+                    _den = _denA;
+                    return addChecked( _numA, _numB, _num );
+                }
+                long g = gcdInline( _denA, _denB );
+                long summandA, summandB;
+                return mulChecked( _numA, _denB / g, summandA ) && mulChecked( _numB, _denA / g, summandB )
+                    && addChecked( summandA, summandB, _num ) && mulChecked( _denA / g, _denB, _den );
+            }
+
+            /**
+             * Multiplies the two given fractions, which are normalized. The result is normalized as well.
+             * @return false, if an intermediate result overflows.
+             */
+            inline bool mulFractions( long _numA, long _denA, long _numB, long _denB, long& _num, long& _den )
+            {
+                long g1 = gcdInline( _numA, _denB );
+                long g2 = gcdInline( _numB, _denA );
+                return mulChecked( _numA / g1, _numB / g2, _num ) && mulChecked( _denA / g2, _denB / g1, _den );
+            }
+        }
+
         /**
          * Default constructor.
          */
         Numeric::Numeric():
-            mContent( new Rational( 0 ) )
+            mNumerator( 0 ),
+            mDenominator( 1 ),
+            mContent( nullptr )
         {}
 
         /**
@@ -27,15 +121,19 @@ namespace smtrat
          * @param The Rational.
          */
         Numeric::Numeric( const Rational& _value ):
-            mContent( new Rational( _value ) )
-        {}
+            Numeric()
+        {
+            assign( _value );
+        }
 
         /**
          * Constructing from an integer.
          * @param _value The integer.
          */
         Numeric::Numeric( int _value ):
-            mContent( new Rational( _value ) )
+            mNumerator( _value ),
+            mDenominator( 1 ),
+            mContent( nullptr )
         {}
 
         /**
@@ -43,7 +141,9 @@ namespace smtrat
          * @param _value The unsigned integer
          */
         Numeric::Numeric( unsigned int _value ):
-            mContent( new Rational( _value ) )
+            mNumerator( (long) _value ),
+            mDenominator( 1 ),
+            mContent( nullptr )
         {}
 
         /**
@@ -51,7 +151,9 @@ namespace smtrat
          * @param _value The unsigned long integer.
          */
         Numeric::Numeric( long _value ):
-            mContent( new Rational( _value ) )
+            mNumerator( _value ),
+            mDenominator( 1 ),
+            mContent( _value < -MAX_INLINE ? new Rational( _value ) : nullptr )
         {}
 
         /**
@@ -59,7 +161,9 @@ namespace smtrat
          * @param _value The unsigned long integer.
          */
         Numeric::Numeric( unsigned long _value ):
-            mContent( new Rational( _value ) )
+            mNumerator( (long) _value ),
+            mDenominator( 1 ),
+            mContent( _value > (unsigned long) MAX_INLINE ? new Rational( _value ) : nullptr )
         {}
 
         /**
@@ -67,22 +171,127 @@ namespace smtrat
          * @param _value The char array.
          */
         Numeric::Numeric( const char* _value ):
-            mContent( new Rational( _value ) )
-        {}
+            Numeric()
+        {
+            assign( Rational( _value ) );
+        }
 
         /**
          * Copy constructor.
          * @param _value The Numeric to copy.
          */
         Numeric::Numeric( const Numeric& _value ):
-            mContent( new Rational( *_value.mContent ) )
+            mNumerator( _value.mNumerator ),
+            mDenominator( _value.mDenominator ),
+            mContent( _value.isInline() ? nullptr : new Rational( *_value.mContent ) )
         {}
 
+        /**
+         * Move constructor.
+         * @param _value The Numeric to move.
+         */
+        Numeric::Numeric( Numeric&& _value ):
+            mNumerator( _value.mNumerator ),
+            mDenominator( _value.mDenominator ),
+            mContent( _value.mContent )
+        {
+            _value.mContent = nullptr;
+        }
+
         Numeric::~Numeric()
         {
             delete mContent;
         }
 
+        /**
+         * Sets this Numeric to the given fraction, which is normalized and stored inline.
+         * @param _numerator The numerator, which must not be the smallest long.
+         * @param _denominator The denominator, which must be neither zero nor the smallest long.
+         */
+        void Numeric::assign( long _numerator, long _denominator )
+        {
+            assert( _denominator != 0 );
+            if( _denominator < 0 )
+            {
+                _numerator = -_numerator;
+                _denominator = -_denominator;
+            }
+            if( _denominator != 1 )
+            {
+                long g = gcdInline( _numerator, _denominator );
+                _numerator /= g;
+                _denominator /= g;
+            }
+            mNumerator = _numerator;
+            mDenominator = _denominator;
+            delete mContent;
+            mContent = nullptr;
+        }
+
+        /**
+         * Sets this Numeric to the given Rational, which is stored inline if it fits.
+         * @param _value The Rational.
+         */
+        void Numeric::assign( const Rational& _value )
+        {
+            Integer numerator = carl::getNum( _value );
+            Integer denominator = carl::getDenom( _value );
+            if( numerator >= -MAX_INLINE && numerator <= MAX_INLINE && denominator <= MAX_INLINE )
+            {
+                mNumerator = carl::toInt<carl::sint>( numerator );
+                mDenominator = carl::toInt<carl::sint>( denominator );
+                delete mContent;
+                mContent = nullptr;
+            }
+            else if( isInline() )
+                mContent = new Rational( _value );
+            else
+                *mContent = _value;
+        }
+
+        /**
+         * @param _value The Numeric to compare with.
+         * @return A negative integer, if this Numeric is less than the given one, zero, if they are equal, and a
+         *         positive integer, otherwise.
+         */
+        int Numeric::compare( const Numeric& _value ) const
+        {
+            if( isInline() && _value.isInline() )
+            {
+                if( mDenominator == _value.mDenominator )
+                    return mNumerator < _value.mNumerator ? -1 : (mNumerator > _value.mNumerator ? 1 : 0);
+                long lhs, rhs;
+                if( mulChecked( mNumerator, _value.mDenominator, lhs ) && mulChecked( _value.mNumerator, mDenominator, rhs ) )
+                    return lhs < rhs ? -1 : (lhs > rhs ? 1 : 0);
+            }
+            Rational lhs = content();
+            Rational rhs = _value.content();
+            return lhs < rhs ? -1 : (lhs > rhs ? 1 : 0);
+        }
+
+        /**
+         * @return The value of this Numeric as a Rational.
+         */
+        Rational Numeric::content() const
+        {
+            if( !isInline() )
+                return *mContent;
+            if( mDenominator == 1 )
+                return Rational( mNumerator );
+            return Rational( Rational( mNumerator ) / Rational( mDenominator ) );
+        }
+
+        /**
+         * Stores this Numeric as a Rational, if it is stored inline.
+         * @return A reference to the value of this Numeric, which stays valid until another value is assigned to it.
+         */
+        Rational& Numeric::rContent()
+        {
+            if( isInline() )
+                mContent = new Rational( content() );
+            return *mContent;
+        }
+
         /**
          * Cast from an integer.
          * @param _value The integer.
@@ -90,7 +299,8 @@ namespace smtrat
          */
         Numeric& Numeric::operator=( int _value )
         {
-            return operator=( Numeric( _value ) );
+            assign( _value, 1 );
+            return *this;
         }
 
         /**
@@ -100,7 +310,8 @@ namespace smtrat
          */
         Numeric& Numeric::operator=( unsigned int _value )
         {
-            return operator=( Numeric( _value ) );
+            assign( (long) _value, 1 );
+            return *this;
         }
 
         /**
@@ -130,7 +341,8 @@ namespace smtrat
          */
         Numeric& Numeric::operator=( const char* _value )
         {
-            return operator=( Numeric( _value ) );
+            assign( Rational( _value ) );
+            return *this;
         }
 
         /**
@@ -140,7 +352,23 @@ namespace smtrat
          */
         Numeric& Numeric::operator=( const Numeric& _value )
         {
-            *mContent = _value.content();
+            if( _value.isInline() )
+                assign( _value.mNumerator, _value.mDenominator );
+            else
+                assign( *_value.mContent );
+            return *this;
+        }
+
+        /**
+         * Move assignment.
+         * @param _value The Numeric to move.
+         * @return This Numeric.
+         */
+        Numeric& Numeric::operator=( Numeric&& _value )
+        {
+            mNumerator = _value.mNumerator;
+            mDenominator = _value.mDenominator;
+            std::swap( mContent, _value.mContent );
             return *this;
         }
 
@@ -152,6 +380,8 @@ namespace smtrat
          */
         bool Numeric::operator==( const Numeric& _value ) const
         {
+            if( isInline() && _value.isInline() )
+                return mNumerator == _value.mNumerator && mDenominator == _value.mDenominator;
             return this->content() == _value.content();
         }
 
@@ -163,7 +393,7 @@ namespace smtrat
          */
         bool Numeric::operator!=( const Numeric& _value ) const
         {
-            return this->content() != _value.content();
+            return !(*this == _value);
         }
 
         /**
@@ -174,7 +404,7 @@ namespace smtrat
          */
         bool Numeric::operator<( const Numeric& _value ) const
         {
-            return this->content() < _value.content();
+            return compare( _value ) < 0;
         }
 
         /**
@@ -185,7 +415,7 @@ namespace smtrat
          */
         bool Numeric::operator<=( const Numeric& _value ) const
         {
-            return this->content() <= _value.content();
+            return compare( _value ) <= 0;
         }
 
         /**
@@ -196,7 +426,7 @@ namespace smtrat
          */
         bool Numeric::operator>( const Numeric& _value ) const
         {
-            return this->content() > _value.content();
+            return compare( _value ) > 0;
         }
 
         /**
@@ -207,7 +437,7 @@ namespace smtrat
          */
         bool Numeric::operator>=( const Numeric& _value ) const
         {
-            return this->content() >= _value.content();
+            return compare( _value ) >= 0;
         }
 
         /**
@@ -215,6 +445,8 @@ namespace smtrat
          */
         Numeric Numeric::numer() const
         {
+            if( isInline() )
+                return Numeric( mNumerator );
             return Numeric( carl::getNum( this->content() ) );
         }
 
@@ -223,6 +455,8 @@ namespace smtrat
          */
         Numeric Numeric::denom() const
         {
+            if( isInline() )
+                return Numeric( mDenominator );
             return Numeric( carl::getDenom( this->content() ) );
         }
         
@@ -231,6 +465,12 @@ namespace smtrat
          */
         Numeric Numeric::floor() const
         {
+            if( isInline() )
+            {
+                // the division rounds towards zero
+                long quotient = mNumerator / mDenominator;
+                return Numeric( (mNumerator < 0 && mDenominator != 1) ? quotient - 1 : quotient );
+            }
             return Numeric( carl::floor( this->content() ) );
         }
 
@@ -241,7 +481,7 @@ namespace smtrat
          */
         bool Numeric::isPositive() const
         {
-            return ( this->content() > 0 );
+            return isInline() ? mNumerator > 0 : *mContent > 0;
         }
 
         /**
@@ -250,7 +490,7 @@ namespace smtrat
          */
         bool Numeric::isNegative() const
         {
-            return ( this->content() < 0 );
+            return isInline() ? mNumerator < 0 : *mContent < 0;
         }
 
         /**
@@ -259,7 +499,7 @@ namespace smtrat
          */
         bool Numeric::isZero() const
         {
-            return ( this->content() == 0 );
+            return isInline() ? mNumerator == 0 : *mContent == 0;
         }
 
         /**
@@ -268,7 +508,7 @@ namespace smtrat
          */
         bool Numeric::isInteger() const
         {
-            return ( this->denom() == 1 );
+            return isInline() ? mDenominator == 1 : carl::isInteger( *mContent );
         }
 
         /**
@@ -278,7 +518,7 @@ namespace smtrat
          */
         Numeric abs( const Numeric& _value )
         {
-            return Numeric( carl::abs( _value.content() ) );
+            return _value.isNegative() ? -_value : _value;
         }
         
         /**
@@ -292,9 +532,40 @@ namespace smtrat
         {
             assert( _valueA.isInteger() && _valueB.isInteger() );
             assert( !_valueB.isZero() );
+            if( _valueA.isInline() && _valueB.isInline() )
+                return Numeric( _valueA.mNumerator % _valueB.mNumerator );
             return Numeric( carl::mod( carl::getNum( _valueA.content() ), carl::getNum( _valueB.content() ) ) );
         }
         
+        /**
+         * Calculates the quotient of the first argument divided by the second argument rounded towards zero.
+         * Note, that this method can only be applied to integers.
+         * @param _valueA An integer.
+         * @param _valueB An integer != 0.
+         * @return The integer quotient of the two arguments.
+         */
+        Numeric div( const Numeric& _valueA, const Numeric& _valueB )
+        {
+            assert( _valueA.isInteger() && _valueB.isInteger() );
+            assert( !_valueB.isZero() );
+            if( _valueA.isInline() && _valueB.isInline() )
+                return Numeric( _valueA.mNumerator / _valueB.mNumerator );
+            return Numeric( carl::div( carl::getNum( _valueA.content() ), carl::getNum( _valueB.content() ) ) );
+        }
+
+        /**
+         * Divides the first argument by the second argument rounded towards zero.
+         * Note, that this method can only be applied to integers.
+         * @param _valueA An integer.
+         * @param _valueB An integer != 0.
+         * @return The first argument divided by the second argument.
+         */
+        Numeric& div_assign( Numeric& _valueA, const Numeric& _valueB )
+        {
+            _valueA = div( _valueA, _valueB );
+            return _valueA;
+        }
+
         /**
          * Calculates the least common multiple of the two arguments.
          * Note, that this method can only be applied to integers.
@@ -307,6 +578,12 @@ namespace smtrat
             assert( _valueA.isInteger() && _valueB.isInteger() );
             if( _valueA.isZero() || _valueB.isZero() )
                 return Numeric( 0 );
+            if( _valueA.isInline() && _valueB.isInline() )
+            {
+                long result;
+                if( mulChecked( std::abs( _valueA.mNumerator ) / gcdInline( _valueA.mNumerator, _valueB.mNumerator ), std::abs( _valueB.mNumerator ), result ) )
+                    return Numeric( result );
+            }
             return Numeric( carl::lcm( carl::getNum( _valueA.content() ), carl::getNum( _valueB.content() ) ) );
         }
         
@@ -322,9 +599,24 @@ namespace smtrat
             assert( _valueA.isInteger() && _valueB.isInteger() );
             if( _valueA.isZero() || _valueB.isZero() )
                 return Numeric( 0 );
+            if( _valueA.isInline() && _valueB.isInline() )
+                return Numeric( gcdInline( _valueA.mNumerator, _valueB.mNumerator ) );
             return Numeric( carl::gcd( carl::getNum( _valueA.content() ), carl::getNum( _valueB.content() ) ) );
         }
 
+        /**
+         * Sets the first argument to the greatest common divisor of the two arguments.
+         * Note, that this method can only be applied to integers.
+         * @param _valueA An integer.
+         * @param _valueB An integer.
+         * @return The first argument set to the greatest common divisor of the two arguments.
+         */
+        Numeric& gcd_assign( Numeric& _valueA, const Numeric& _valueB )
+        {
+            _valueA = gcd( _valueA, _valueB );
+            return _valueA;
+        }
+
         /**
          * Calculates the sum of the two given Numerics.
          * @param _valueA The first summand.
@@ -333,7 +625,14 @@ namespace smtrat
          */
         Numeric operator+( const Numeric& _valueA, const Numeric& _valueB )
         {
-            return Numeric( _valueA.content() + _valueB.content() );
+            Numeric result;
+            long num, den;
+            if( _valueA.isInline() && _valueB.isInline() 
+                && addFractions( _valueA.mNumerator, _valueA.mDenominator, _valueB.mNumerator, _valueB.mDenominator, num, den ) )
+                result.assign( num, den );
+            else
+                result.assign( _valueA.content() + _valueB.content() );
+            return result;
         }
 
         /**
@@ -344,7 +643,7 @@ namespace smtrat
          */
         Numeric operator-( const Numeric& _valueA, const Numeric& _valueB )
         {
-            return Numeric( _valueA.content() - _valueB.content() );
+            return _valueA + (-_valueB);
         }
 
         /**
@@ -355,7 +654,17 @@ namespace smtrat
          */
         Numeric operator*( const Numeric& _valueA, const Numeric& _valueB )
         {
-            return Numeric( _valueA.content() * _valueB.content() );
+            Numeric result;
+            long num, den;
+            if( _valueA.isInline() && _valueB.isInline() 
+                && mulFractions( _valueA.mNumerator, _valueA.mDenominator, _valueB.mNumerator, _valueB.mDenominator, num, den ) )
+            {
+                result.mNumerator = num;
+                result.mDenominator = den;
+            }
+            else
+                result.assign( _valueA.content() * _valueB.content() );
+            return result;
         }
 
         /**
@@ -366,7 +675,23 @@ namespace smtrat
          */
         Numeric operator/( const Numeric& _valueA, const Numeric& _valueB )
         {
-            return Numeric( _valueA.content() / _valueB.content() );    
+            assert( !_valueB.isZero() );
+            Numeric result;
+            long num, den;
+            if( _valueA.isInline() && _valueB.isInline() )
+            {
+                // multiply by the inverse of the divisor, whose denominator has to be positive
+                long invNum = _valueB.mNumerator < 0 ? -_valueB.mDenominator : _valueB.mDenominator;
+                long invDen = std::abs( _valueB.mNumerator );
+                if( mulFractions( _valueA.mNumerator, _valueA.mDenominator, invNum, invDen, num, den ) )
+                {
+                    result.mNumerator = num;
+                    result.mDenominator = den;
+                    return result;
+                }
+            }
+            result.assign( _valueA.content() / _valueB.content() );
+            return result;
         }
 
         /**
@@ -377,7 +702,7 @@ namespace smtrat
          */
         Numeric& operator+=( Numeric& _valueA, const Numeric& _valueB )
         {
-            _valueA.rContent() += _valueB.content();
+            _valueA = _valueA + _valueB;
             return _valueA;
         }
 
@@ -389,7 +714,7 @@ namespace smtrat
          */
         Numeric& operator-=( Numeric& _valueA, const Numeric& _valueB )
         {
-            _valueA.rContent() -= _valueB.content();
+            _valueA = _valueA - _valueB;
             return _valueA;
         }
 
@@ -401,7 +726,7 @@ namespace smtrat
          */
         Numeric& operator*=( Numeric& _valueA, const Numeric& _valueB )
         {
-            _valueA.rContent() *= _valueB.content();
+            _valueA = _valueA * _valueB;
             return _valueA;
         }
 
@@ -413,7 +738,7 @@ namespace smtrat
          */
         Numeric& operator/=( Numeric& _valueA, const Numeric& _valueB )
         {
-            _valueA.rContent() /= _valueB.content();
+            _valueA = _valueA / _valueB;
             return _valueA;
         }
 
@@ -424,7 +749,15 @@ namespace smtrat
          */
         Numeric operator-( const Numeric& _value )
         {
-            return Numeric( -_value.content() );
+            Numeric result;
+            if( _value.isInline() )
+            {
+                result.mNumerator = -_value.mNumerator;
+                result.mDenominator = _value.mDenominator;
+            }
+            else
+                result.assign( -_value.content() );
+            return result;
         }
 
         /**
@@ -434,7 +767,7 @@ namespace smtrat
          */
         Numeric& operator++( Numeric& _value )
         {
-            _value.rContent()++;
+            _value += Numeric( 1 );
             return _value;
         }
 
@@ -445,7 +778,7 @@ namespace smtrat
          */
         Numeric& operator--( Numeric& _value )
         {
-            _value.rContent()--;
+            _value -= Numeric( 1 );
             return _value;
         }
 
@@ -457,7 +790,14 @@ namespace smtrat
          */
         ostream& operator <<( ostream& _out, const Numeric& _value )
         {
-            _out << _value.content();
+            if( _value.isInline() )
+            {
+                _out << _value.mNumerator;
+                if( _value.mDenominator != 1 )
+                    _out << "/" << _value.mDenominator;
+            }
+            else
+                _out << *_value.mContent;
             return _out;
         }
     } // end namespace lra
@@ -17,12 +17,32 @@ namespace smtrat
 {
     namespace lra
     {
+        /**
+         * A rational number, which is stored inline as a pair of 64-bit integers as long as its numerator and
+         * denominator fit into them. Otherwise, i.e., if an operation overflows, it is stored as a Rational, which is
+         * turned into the inline representation again as soon as the result of an operation fits.
+         */
         class Numeric
         {
         private:
             // Members:
+            /// The numerator, if this Numeric is stored inline.
+            long mNumerator;
+            /// The positive denominator coprime to the numerator, if this Numeric is stored inline.
+            long mDenominator;
+            /// The value, if it does not fit into the inline representation, otherwise nullptr.
             Rational* mContent;
 
+            // Methods:
+            bool isInline() const
+            {
+                return mContent == nullptr;
+            }
+
+            void assign( long, long );
+            void assign( const Rational& );
+            int compare( const Numeric& ) const;
+
         public:
             // Constructors/Destructor:
             Numeric();
@@ -33,17 +53,16 @@ namespace smtrat
             Numeric( unsigned long );
             Numeric( const char* );
             Numeric( const Numeric& );
+            Numeric( Numeric&& );
             ~Numeric();
 
             // Methods:
-            const Rational& content() const
-            {
-                return *mContent;
-            }
+            Rational content() const;
+            Rational& rContent();
 
-            Rational& rContent()
+            operator Rational() const
             {
-                return *mContent;
+                return content();
             }
 
             Numeric& operator=( int );
@@ -52,6 +71,7 @@ namespace smtrat
             Numeric& operator=( unsigned long );
             Numeric& operator=( const char* );
             Numeric& operator=( const Numeric& );
+            Numeric& operator=( Numeric&& );
 
             bool operator==( const Numeric& ) const;
             bool operator!=( const Numeric& ) const;
@@ -68,10 +88,23 @@ namespace smtrat
             bool isNegative() const;
             bool isZero() const;
             bool isInteger() const;
+
+            friend Numeric operator+( const Numeric&, const Numeric& );
+            friend Numeric operator*( const Numeric&, const Numeric& );
+            friend Numeric operator/( const Numeric&, const Numeric& );
+            friend Numeric operator-( const Numeric& );
+            friend Numeric mod( const Numeric&, const Numeric& );
+            friend Numeric div( const Numeric&, const Numeric& );
+            friend Numeric lcm( const Numeric&, const Numeric& );
+            friend Numeric gcd( const Numeric&, const Numeric& );
+            friend std::ostream& operator <<( std::ostream&, const Numeric& );
         };
 
         Numeric abs( const Numeric& );
         Numeric mod( const Numeric&, const Numeric& );
+        Numeric div( const Numeric&, const Numeric& );
+        Numeric& div_assign( Numeric&, const Numeric& );
+        Numeric& gcd_assign( Numeric&, const Numeric& );
         Numeric lcm( const Numeric&, const Numeric& );
         Numeric gcd( const Numeric&, const Numeric& );
         Numeric operator+( const Numeric&, const Numeric& );
@@ -89,5 +122,49 @@ namespace smtrat
     } // namespace lra
 } // namespace smtrat
 
+namespace carl
+{
+    // The tableau calls the operations on its entries and bounds qualified by carl, as for carl::Numeric.
+    inline smtrat::lra::Numeric abs( const smtrat::lra::Numeric& _value )
+    {
+        return smtrat::lra::abs( _value );
+    }
+
+    inline smtrat::lra::Numeric div( const smtrat::lra::Numeric& _valueA, const smtrat::lra::Numeric& _valueB )
+    {
+        return smtrat::lra::div( _valueA, _valueB );
+    }
+
+    inline smtrat::lra::Numeric& div_assign( smtrat::lra::Numeric& _valueA, const smtrat::lra::Numeric& _valueB )
+    {
+        return smtrat::lra::div_assign( _valueA, _valueB );
+    }
+
+    inline smtrat::lra::Numeric lcm( const smtrat::lra::Numeric& _valueA, const smtrat::lra::Numeric& _valueB )
+    {
+        return smtrat::lra::lcm( _valueA, _valueB );
+    }
+
+    inline smtrat::lra::Numeric gcd( const smtrat::lra::Numeric& _valueA, const smtrat::lra::Numeric& _valueB )
+    {
+        return smtrat::lra::gcd( _valueA, _valueB );
+    }
+
+    inline smtrat::lra::Numeric& gcd_assign( smtrat::lra::Numeric& _valueA, const smtrat::lra::Numeric& _valueB )
+    {
+        return smtrat::lra::gcd_assign( _valueA, _valueB );
+    }
+
+    inline bool isInteger( const smtrat::lra::Numeric& _value )
+    {
+        return _value.isInteger();
+    }
+
+    inline smtrat::lra::Numeric floor( const smtrat::lra::Numeric& _value )
+    {
+        return _value.floor();
+    }
+}
+
 #endif	/* NUMERIC_H */
 
@@ -7,10 +7,14 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <vector>
 #include <stack>
 #include <map>
 #include <deque>
+#include "Numeric.h"
 #include "Variable.h"
 #include "carl/util/IDGenerator.h"
 
@@ -258,8 +262,10 @@ namespace smtrat
                 std::vector<Variable<T1,T2>*> mColumns;    // First element is the end of the column and the second the length of the column.
                 ///
                 std::list<std::list<std::pair<Variable<T1,T2>*,T2>>> mNonActiveBasics;
-                ///
+                /// The entries, where the entries of a row are stored consecutively from left to right after the entries have been compressed.
                 std::vector<TableauEntry<T1,T2> >* mpEntries;
+                /// The number of entries created since the entries have been compressed.
+                size_t mEntriesCreatedSinceCompression;
                 ///
                 std::vector<Variable<T1,T2>*> mConflictingRows;
                 ///
@@ -653,12 +659,29 @@ namespace smtrat
                  */
                 void compressRows();
                 
+                /**
+                 * Stores the entries row by row, such that traversing a row accesses consecutive memory, if many entries have been
+                 * created since the last compression. The ids of all entries change, hence no entry ids must be kept when calling
+                 * this method.
+                 */
+                void compressEntries();
+                
                 /**
                  * 
                  * @return 
                  */
                 std::pair<EntryID, bool> nextPivotingElement();
                 
+                /**
+                 * Searches for a basis, such that all variables satisfy their bounds, in floating-point arithmetic on a copy of
+                 * this tableau and adopts the found basis by pivoting this tableau accordingly. Afterwards, the nonbasic variables
+                 * are set to the bounds they have in the floating-point solution. As the copy is inexact, the resulting assignment
+                 * might still violate bounds, which is repaired by the subsequent exact pivoting steps.
+                 * @return The number of floating-point pivoting steps and the number of exact pivoting steps needed to adopt the
+                 *         found basis.
+                 */
+                std::pair<size_t,size_t> floatingPointSearch();
+                
                 /**
                  * 
                  * @param _objective
@@ -673,6 +696,15 @@ namespace smtrat
                 std::pair<EntryID,bool> nextPivotingElementForOptimizing( const Variable<T1, T2>& _objective );
                 std::pair<EntryID,bool> nextZeroPivotingElementForOptimizing( const Variable<T1, T2>& _objective ) const;
                 
+                /**
+                 * Pivots this tableau, such that the variables with the given ids become basic, as far as possible.
+                 * @param _basic The ids of the variables, which shall be basic.
+                 * @param _atBound For the ids of the variables, which shall be nonbasic, the bound the variable shall be set to,
+                 *                 where -1 stands for the infimum, 1 for the supremum and 0 for keeping the assignment.
+                 * @return The number of pivoting steps.
+                 */
+                size_t adoptBasis( const std::vector<bool>& _basic, const std::vector<int>& _atBound );
+                
                 /**
                  * 
                  * @param _basicVar
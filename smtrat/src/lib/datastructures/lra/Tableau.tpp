@@ -31,6 +31,7 @@ namespace smtrat
             mRows(),
             mColumns(),
             mNonActiveBasics(),
+            mEntriesCreatedSinceCompression( 0 ),
             mConflictingRows(),
             mCurDelta( 0 ),
             mOriginalVars(),
@@ -73,6 +74,7 @@ namespace smtrat
         template<class Settings, typename T1, typename T2>
         EntryID Tableau<Settings,T1,T2>::newTableauEntry( const T2& _content )
         {
+            ++mEntriesCreatedSinceCompression;
             if( mUnusedIDs.empty() )
             {
                 mpEntries->push_back( TableauEntry<T1,T2>( LAST_ENTRY_ID, LAST_ENTRY_ID, LAST_ENTRY_ID, LAST_ENTRY_ID, 0, 0, _content ) );
@@ -875,6 +877,48 @@ namespace smtrat
             mRowsCompressed = true;
         }
 
+        template<class Settings, typename T1, typename T2>
+        void Tableau<Settings,T1,T2>::compressEntries()
+        {
+            if( !Settings::compress_entries || 2 * mEntriesCreatedSinceCompression <= size() )
+                return;
+            std::vector<TableauEntry<T1,T2> >* entries = new std::vector<TableauEntry<T1,T2> >();
+            entries->reserve( mpEntries->size() - mUnusedIDs.size() );
+            entries->push_back( TableauEntry<T1,T2>() );
+            // Copy the entries row by row and remember their new ids. Entries not belonging to a row are unused.
+            std::vector<EntryID> newIDs( mpEntries->size(), LAST_ENTRY_ID );
+            for( Variable<T1,T2>* rowVar : mRows )
+            {
+                if( rowVar == NULL )
+                    continue;
+                EntryID entryID = rowVar->startEntry();
+                while( entryID != LAST_ENTRY_ID )
+                {
+                    newIDs[entryID] = entries->size();
+                    entries->push_back( (*mpEntries)[entryID] );
+                    entryID = (*mpEntries)[entryID].hNext( false );
+                }
+            }
+            for( auto entry = entries->begin() + 1; entry != entries->end(); ++entry )
+            {
+                entry->setVNext( false, newIDs[entry->vNext( false )] );
+                entry->setVNext( true, newIDs[entry->vNext( true )] );
+                entry->setHNext( true, newIDs[entry->hNext( true )] );
+                entry->setHNext( false, newIDs[entry->hNext( false )] );
+            }
+            for( Variable<T1,T2>* rowVar : mRows )
+            {
+                if( rowVar != NULL )
+                    rowVar->rStartEntry() = newIDs[rowVar->startEntry()];
+            }
+            for( Variable<T1,T2>* columnVar : mColumns )
+                columnVar->rStartEntry() = newIDs[columnVar->startEntry()];
+            delete mpEntries;
+            mpEntries = entries;
+            mUnusedIDs = std::stack<EntryID>();
+            mEntriesCreatedSinceCompression = 0;
+        }
+
         template<class Settings, typename T1, typename T2>
         std::pair<EntryID,bool> Tableau<Settings,T1,T2>::nextPivotingElement()
         {
@@ -1079,6 +1123,288 @@ namespace smtrat
             }
         }
 
+        template<class Settings, typename T1, typename T2>
+        std::pair<size_t,size_t> Tableau<Settings,T1,T2>::floatingPointSearch()
+        {
+            if( mRows.size() < Settings::float_simplex_min_rows )
+                return std::make_pair( 0, 0 );
+            bool violated = false;
+            for( const Variable<T1,T2>* basicVar : mRows )
+            {
+                if( basicVar->supremum() < basicVar->assignment() || basicVar->infimum() > basicVar->assignment() )
+                {
+                    violated = true;
+                    break;
+                }
+            }
+            if( !violated )
+                return std::make_pair( 0, 0 );
+            // A value c+k*delta is represented by the pair (c,k), which is compared lexicographically.
+            typedef std::pair<double,double> FloatValue;
+            typedef std::vector<std::pair<size_t,double>> FloatRow;
+            const size_t NONE = std::numeric_limits<size_t>::max();
+            const double tolerance = Settings::float_simplex_tolerance;
+            auto equal = [tolerance]( double _a, double _b )
+            {
+                return std::abs( _a - _b ) <= tolerance * (1 + std::max( std::abs( _a ), std::abs( _b ) ));
+            };
+            auto less = [&equal]( const FloatValue& _a, const FloatValue& _b )
+            {
+                if( equal( _a.first, _b.first ) )
+                    return !equal( _a.second, _b.second ) && _a.second < _b.second;
+                return _a.first < _b.first;
+            };
+            auto toFloat = []( const Value<T1>& _value )
+            {
+                return FloatValue( carl::toDouble( (Rational)_value.mainPart() ), carl::toDouble( (Rational)_value.deltaPart() ) );
+            };
+            // Copy the tableau, where the variables of the rows come first and then the variables of the columns.
+            std::vector<Variable<T1,T2>*> vars( mRows.begin(), mRows.end() );
+            vars.insert( vars.end(), mColumns.begin(), mColumns.end() );
+            std::vector<FloatValue> values, lower, upper;
+            std::vector<bool> hasLower, hasUpper;
+            size_t maxId = 0;
+            for( const Variable<T1,T2>* var : vars )
+            {
+                values.push_back( toFloat( var->assignment() ) );
+                hasLower.push_back( !var->infimum().isInfinite() );
+                lower.push_back( hasLower.back() ? toFloat( var->infimum().limit() ) : FloatValue( 0, 0 ) );
+                hasUpper.push_back( !var->supremum().isInfinite() );
+                upper.push_back( hasUpper.back() ? toFloat( var->supremum().limit() ) : FloatValue( 0, 0 ) );
+                maxId = std::max( maxId, var->getId() );
+            }
+            std::vector<FloatRow> rows( mRows.size() );
+            std::vector<size_t> basicOf( mRows.size() );
+            std::vector<size_t> rowOf( vars.size(), NONE );
+            for( size_t r = 0; r < mRows.size(); ++r )
+            {
+                basicOf[r] = r;
+                rowOf[r] = r;
+                double factor = Settings::omit_division ? carl::toDouble( (Rational)mRows[r]->factor() ) : 1;
+                // The entries of a row are ordered by the position of their columns.
+                Iterator rowIter = Iterator( mRows[r]->startEntry(), mpEntries );
+                while( true )
+                {
+                    rows[r].emplace_back( mRows.size() + (*rowIter).columnVar()->position(), carl::toDouble( (Rational)(*rowIter).content() ) / factor );
+                    if( rowIter.hEnd( false ) )
+                        break;
+                    rowIter.hMove( false );
+                }
+            }
+            auto findEntry = []( FloatRow& _row, size_t _var )
+            {
+                auto entry = std::lower_bound( _row.begin(), _row.end(), _var, []( const std::pair<size_t,double>& _e, size_t _v ) { return _e.first < _v; } );
+                return (entry != _row.end() && entry->first == _var) ? entry : _row.end();
+            };
+            size_t pivots = 0;
+            const size_t maxPivots = Settings::float_simplex_max_pivots;
+            while( pivots < maxPivots )
+            {
+                // Choose the basic variable violating its bounds the most or, in order to avoid cycling in the second half of the search,
+                // the one with the smallest id.
+                bool blandsRule = 2 * pivots >= maxPivots;
+                size_t leavingRow = NONE;
+                double largestViolation = 0;
+                bool increase = false;
+                for( size_t r = 0; r < rows.size(); ++r )
+                {
+                    size_t b = basicOf[r];
+                    double violation;
+                    bool lowerBoundViolated = hasLower[b] && less( values[b], lower[b] );
+                    if( lowerBoundViolated )
+                        violation = lower[b].first - values[b].first;
+                    else if( hasUpper[b] && less( upper[b], values[b] ) )
+                        violation = values[b].first - upper[b].first;
+                    else
+                        continue;
+                    if( leavingRow == NONE || (blandsRule ? vars[b]->getId() < vars[basicOf[leavingRow]]->getId() : violation > largestViolation) )
+                    {
+                        leavingRow = r;
+                        largestViolation = violation;
+                        increase = lowerBoundViolated;
+                    }
+                }
+                // All bounds are satisfied.
+                if( leavingRow == NONE )
+                    break;
+                // Choose the suitable nonbasic variable with the largest coefficient in order to keep the pivoting stable.
+                FloatRow& pivotingRow = rows[leavingRow];
+                auto entering = pivotingRow.end();
+                for( auto entry = pivotingRow.begin(); entry != pivotingRow.end(); ++entry )
+                {
+                    size_t n = entry->first;
+                    bool suitable = increase == (entry->second > 0) ? (!hasUpper[n] || less( values[n], upper[n] )) : (!hasLower[n] || less( lower[n], values[n] ));
+                    if( suitable && (entering == pivotingRow.end() || (blandsRule ? vars[n]->getId() < vars[entering->first]->getId() : std::abs( entry->second ) > std::abs( entering->second ))) )
+                        entering = entry;
+                }
+                // A conflict, which is detected and explained by the exact simplex.
+                if( entering == pivotingRow.end() )
+                    break;
+                size_t b = basicOf[leavingRow];
+                size_t q = entering->first;
+                double a = entering->second;
+                // Update the assignment, such that the leaving variable is set to its violated bound.
+                const FloatValue& target = increase ? lower[b] : upper[b];
+                FloatValue theta( (target.first - values[b].first) / a, (target.second - values[b].second) / a );
+                values[q].first += theta.first;
+                values[q].second += theta.second;
+                for( size_t r = 0; r < rows.size(); ++r )
+                {
+                    auto entry = findEntry( rows[r], q );
+                    if( entry != rows[r].end() )
+                    {
+                        values[basicOf[r]].first += entry->second * theta.first;
+                        values[basicOf[r]].second += entry->second * theta.second;
+                    }
+                }
+                values[b] = target;
+                // Solve the pivoting row for the entering variable.
+                FloatRow newRow;
+                newRow.reserve( pivotingRow.size() );
+                bool leavingInserted = false;
+                for( const auto& entry : pivotingRow )
+                {
+                    if( !leavingInserted && b < entry.first )
+                    {
+                        newRow.emplace_back( b, 1 / a );
+                        leavingInserted = true;
+                    }
+                    if( entry.first != q )
+                        newRow.emplace_back( entry.first, -entry.second / a );
+                }
+                if( !leavingInserted )
+                    newRow.emplace_back( b, 1 / a );
+                // Substitute the entering variable in all other rows.
+                for( size_t r = 0; r < rows.size(); ++r )
+                {
+                    if( r == leavingRow )
+                        continue;
+                    auto entry = findEntry( rows[r], q );
+                    if( entry == rows[r].end() )
+                        continue;
+                    double c = entry->second;
+                    rows[r].erase( entry );
+                    FloatRow merged;
+                    merged.reserve( rows[r].size() + newRow.size() );
+                    auto iterA = rows[r].begin();
+                    auto iterB = newRow.begin();
+                    while( iterA != rows[r].end() || iterB != newRow.end() )
+                    {
+                        if( iterB == newRow.end() || (iterA != rows[r].end() && iterA->first < iterB->first) )
+                            merged.push_back( *iterA++ );
+                        else if( iterA == rows[r].end() || iterB->first < iterA->first )
+                        {
+                            merged.emplace_back( iterB->first, c * iterB->second );
+                            ++iterB;
+                        }
+                        else
+                        {
+                            double sum = iterA->second + c * iterB->second;
+                            // Drop entries, which are most likely zero in exact arithmetic.
+                            if( std::abs( sum ) > tolerance )
+                                merged.emplace_back( iterA->first, sum );
+                            ++iterA;
+                            ++iterB;
+                        }
+                    }
+                    rows[r].swap( merged );
+                }
+                pivotingRow.swap( newRow );
+                basicOf[leavingRow] = q;
+                rowOf[q] = leavingRow;
+                rowOf[b] = NONE;
+                ++pivots;
+            }
+            // Adopt the found basis and the bounds the nonbasic variables are set to.
+            std::vector<bool> basic( maxId + 1, false );
+            std::vector<int> atBound( maxId + 1, 0 );
+            for( size_t i = 0; i < vars.size(); ++i )
+            {
+                size_t id = vars[i]->getId();
+                if( rowOf[i] != NONE )
+                    basic[id] = true;
+                else if( hasLower[i] && equal( values[i].first, lower[i].first ) && equal( values[i].second, lower[i].second ) )
+                    atBound[id] = -1;
+                else if( hasUpper[i] && equal( values[i].first, upper[i].first ) && equal( values[i].second, upper[i].second ) )
+                    atBound[id] = 1;
+            }
+            return std::make_pair( pivots, adoptBasis( basic, atBound ) );
+        }
+
+        template<class Settings, typename T1, typename T2>
+        size_t Tableau<Settings,T1,T2>::adoptBasis( const std::vector<bool>& _basic, const std::vector<int>& _atBound )
+        {
+            auto shallBeBasic = [&_basic]( const Variable<T1,T2>& _var )
+            {
+                return _var.getId() < _basic.size() && _basic[_var.getId()];
+            };
+            // The value a nonbasic variable shall have, which always satisfies its bounds.
+            auto targetValue = [&_atBound]( const Variable<T1,T2>& _var ) -> Value<T1>
+            {
+                int bound = _var.getId() < _atBound.size() ? _atBound[_var.getId()] : 0;
+                if( bound < 0 && !_var.infimum().isInfinite() )
+                    return _var.infimum().limit();
+                if( bound > 0 && !_var.supremum().isInfinite() )
+                    return _var.supremum().limit();
+                if( _var.infimum() > _var.assignment() )
+                    return _var.infimum().limit();
+                if( _var.supremum() < _var.assignment() )
+                    return _var.supremum().limit();
+                return _var.assignment();
+            };
+            // Every pivoting step increases the number of basic variables which shall be basic, hence this terminates. If the given basis
+            // is singular in exact arithmetic, some of the variables stay nonbasic.
+            size_t pivots = 0;
+            bool pivoted = true;
+            while( pivoted )
+            {
+                pivoted = false;
+                for( size_t pos = 0; pos < mColumns.size(); ++pos )
+                {
+                    const Variable<T1,T2>& nonbasicVar = *mColumns[pos];
+                    if( nonbasicVar.size() == 0 || !shallBeBasic( nonbasicVar ) )
+                        continue;
+                    EntryID pivotingElement = LAST_ENTRY_ID;
+                    Iterator columnIter = Iterator( nonbasicVar.startEntry(), mpEntries );
+                    while( true )
+                    {
+                        if( !shallBeBasic( *(*columnIter).rowVar() ) )
+                        {
+                            pivotingElement = columnIter.entryID();
+                            break;
+                        }
+                        if( columnIter.vEnd( false ) )
+                            break;
+                        columnIter.vMove( false );
+                    }
+                    if( pivotingElement == LAST_ENTRY_ID )
+                        continue;
+                    // The leaving variable is moved to its target value.
+                    const Variable<T1,T2>& basicVar = *(*mpEntries)[pivotingElement].rowVar();
+                    *mpTheta = targetValue( basicVar ) - basicVar.assignment();
+                    if( Settings::omit_division )
+                        (*mpTheta) *= basicVar.factor();
+                    (*mpTheta) /= (*mpEntries)[pivotingElement].content();
+                    pivot( pivotingElement );
+                    ++pivots;
+                    pivoted = true;
+                }
+            }
+            for( Variable<T1,T2>* nonbasicVar : mColumns )
+            {
+                Value<T1> target = targetValue( *nonbasicVar );
+                if( target != nonbasicVar->assignment() )
+                {
+                    Value<T1> change = target - nonbasicVar->assignment();
+                    nonbasicVar->rAssignment() = target;
+                    updateBasicAssignments( nonbasicVar->position(), change );
+                }
+            }
+            // The assignment of any basic variable might have changed, hence all rows are considered by the next search for a pivoting element.
+            mConflictingRows.clear();
+            return pivots;
+        }
+
         template<class Settings, typename T1, typename T2>
         std::pair<EntryID,bool> Tableau<Settings,T1,T2>::optimizeIndependentNonbasics( const Variable<T1, T2>& _objective )
         {
@@ -2575,7 +2901,7 @@ namespace smtrat
                     std::cout << "f_zero = " << f_zero << std::endl;
                     std::cout << "(_rowVar->factor() * ( (Rational)1 - f_zero )) = " << (_rowVar->factor() * (Rational(1) - Rational(f_zero))) << std::endl;
                     #endif
-                    coeff = -((*row_iterator).content()/(_rowVar->factor() * (Rational(1) - Rational(f_zero))));
+                    coeff = -((*row_iterator).content()/(_rowVar->factor() * Rational(Rational(1) - Rational(f_zero))));
                     #ifdef LRA_DEBUG_GOMORY_CUT
                     std::cout << "C: coeff = " << coeff << std::endl;
                     #endif
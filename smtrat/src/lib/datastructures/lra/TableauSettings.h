@@ -8,6 +8,8 @@
 
 #pragma once
 
+#include <cstddef>
+
 namespace smtrat
 {   
     namespace lra
@@ -49,10 +51,32 @@ namespace smtrat
              * 
              */
             static const bool omit_division = true;
+            /**
+             * If true, the entries are stored row by row again, as soon as many entries have been created by pivoting.
+             */
+            static const bool compress_entries = true;
             /**
              *
              */
             static constexpr NBCS nonbasic_var_choice_strategy = NBCS::LESS_COLUMN_ENTRIES;
+            /**
+             * If true, a check first searches for a feasible basis on a floating-point copy of the tableau, which is then
+             * adopted by the exact tableau. The exact simplex verifies and, if necessary, repairs the result, hence all
+             * answers and conflicts are still derived in exact arithmetic.
+             */
+            static const bool use_float_simplex = false;
+            /**
+             * The minimal number of rows of the tableau for which the floating-point search pays off.
+             */
+            static const size_t float_simplex_min_rows = 50;
+            /**
+             * The maximal number of pivoting steps of the floating-point search.
+             */
+            static const size_t float_simplex_max_pivots = 10000;
+            /**
+             * The relative tolerance of the floating-point search, below which values are considered equal.
+             */
+            static constexpr double float_simplex_tolerance = 1e-9;
         };
         
         struct TableauSettings2 : TableauSettings1
@@ -64,5 +88,10 @@ namespace smtrat
         {
             static const bool use_refinement = false;
         };
+        
+        struct TableauSettingsFloat : TableauSettings1
+        {
+            static const bool use_float_simplex = true;
+        };
     }
 }
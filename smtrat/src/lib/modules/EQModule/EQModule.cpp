@@ -250,7 +250,7 @@ namespace smtrat {
 				P_add_ineq_edge(indexCLhs, indexCRhs, itrLhs, itrRhs, formula);
 			}
 		} else {
-			P_add_explicit_edge(itrLhs, itrRhs, formula);
+			edge_info *edge = P_add_explicit_edge(itrLhs, itrRhs, formula);
 			
 			std::size_t indexLhs = mUnionFind.find(itrLhs->second.mUFIndex);
 			std::size_t indexRhs = mUnionFind.find(itrRhs->second.mUFIndex);
@@ -264,6 +264,9 @@ namespace smtrat {
 				std::size_t indexCNew = mComponentUnionFind.find(indexNew);
 				std::size_t indexOld = (indexNew == indexLhs) ? indexRhs : indexLhs;
 				std::size_t indexCOld = (indexCNew == indexCLhs) ? indexCRhs : indexCLhs;
+
+				// the new edge joins the two trees in the proof forest; the tree of the class that was merged into the other one is rerooted
+				P_proof_forest_link(indexOld == indexLhs ? edge : edge->mOther);
 				
 				if(indexCLhs == indexCRhs) {
 					P_bfs_search_implicit(mUnionFind[indexLhs], mEqualityGraph.end());
@@ -391,10 +394,10 @@ namespace smtrat {
 			// we only have to remove the inequality edge in case of an inequality
 			P_remove_ineq_edge(itrLhs, itrRhs, formula);
 		} else {
-			P_remove_edge(itrLhs, itrRhs, formula);
+			g_iterator cutRoot = P_remove_edge(itrLhs, itrRhs, formula);
 
-			// we only have to do something if the component splits
-			if(!P_bfs_search_explicit(itrLhs, itrRhs)) {
+			// we only have to do something if the component splits, which requires the edge to be part of the proof forest
+			if(cutRoot != mEqualityGraph.end() && !P_bfs_search_explicit(itrLhs, itrRhs)) {
 				// first we have to split up the lower component and adjust the implicit neighbors
 				
 				std::size_t oldcentry = mUnionFind.find(itrLhs->second.mUFIndex);
@@ -537,6 +540,9 @@ namespace smtrat {
 				
 				// update hash buckets and equality graph iteratively until it stabilizes
 				P_process_split_list();
+			} else if(cutRoot != mEqualityGraph.end()) {
+				// the component is still connected, so the tree that was cut off is linked again by an edge on the path found by the bfs
+				P_proof_forest_reconnect(cutRoot, itrRhs);
 			}
 
 			P_clear_bfs_markings();
@@ -972,7 +978,7 @@ namespace smtrat {
 	}
 
 	template<class Settings>
-		void EQModule<Settings>::P_add_explicit_edge(g_iterator lhs, g_iterator rhs, const FormulaT& formula)
+		auto EQModule<Settings>::P_add_explicit_edge(g_iterator lhs, g_iterator rhs, const FormulaT& formula) -> edge_info*
 	{
 		edge_info *lhs_edge = &mExplicitEdgeAlloc.emplace(lhs,rhs,formula);
 		edge_info *rhs_edge = &mExplicitEdgeAlloc.emplace(rhs,lhs,formula);
@@ -982,6 +988,8 @@ namespace smtrat {
 
 		lhs->second.mExplicit.add(lhs_edge);
 		rhs->second.mExplicit.add(rhs_edge);
+
+		return lhs_edge;
 	}
 
 	template<class Settings>
@@ -1021,13 +1029,102 @@ namespace smtrat {
 	}
 	
 	template<class Settings>
-		void EQModule<Settings>::P_remove_edge(g_iterator lhs, g_iterator rhs, const FormulaT& formula)
+		auto EQModule<Settings>::P_remove_edge(g_iterator lhs, g_iterator rhs, const FormulaT& formula) -> g_iterator
 	{
 		edge_info *lhsptr = lhs->second.find_edge(formula);
 		edge_info *rhsptr = lhsptr->mOther;
+
+		// if the edge is part of the proof forest, the child becomes the root of its subtree
+		g_iterator cutRoot = mEqualityGraph.end();
+		if(lhs->second.mProofEdge == lhsptr) {
+			lhs->second.mProofEdge = nullptr;
+			cutRoot = lhs;
+		} else if(rhs->second.mProofEdge == rhsptr) {
+			rhs->second.mProofEdge = nullptr;
+			cutRoot = rhs;
+		}
 		
 		lhs->second.mExplicit.remove_destroy(lhsptr);
 		rhs->second.mExplicit.remove_destroy(rhsptr);
+		return cutRoot;
+	}
+
+	template<class Settings>
+		void EQModule<Settings>::P_proof_forest_reroot(g_iterator node)
+	{
+		// reverse the edges on the path from node to the root
+		edge_info *reversed = nullptr;
+		for(;;) {
+			edge_info *next = node->second.mProofEdge;
+			node->second.mProofEdge = reversed;
+			if(next == nullptr) break;
+			reversed = next->mOther;
+			node = next->mSucc;
+		}
+	}
+
+	template<class Settings>
+		void EQModule<Settings>::P_proof_forest_link(edge_info* edge)
+	{
+		assert(P_proof_forest_root(edge->mPred) != P_proof_forest_root(edge->mSucc));
+		P_proof_forest_reroot(edge->mPred);
+		edge->mPred->second.mProofEdge = edge;
+	}
+
+	template<class Settings>
+		auto EQModule<Settings>::P_proof_forest_root(g_iterator node) -> g_iterator
+	{
+		while(node->second.mProofEdge != nullptr) {
+			node = node->second.mProofEdge->mSucc;
+		}
+		return node;
+	}
+
+	template<class Settings>
+		bool EQModule<Settings>::P_proof_forest_in_cut_tree(g_iterator node, g_iterator cutRoot)
+	{
+		// walk up until the tree is known, either from a marked node or from the root
+		std::size_t first = mCutTreeMarked.size();
+		while(node->second.mCutTreeMark == 0) {
+			mCutTreeMarked.push_back(node);
+			if(node->second.mProofEdge == nullptr) {
+				node->second.mCutTreeMark = (node == cutRoot) ? 1 : -1;
+				break;
+			}
+			node = node->second.mProofEdge->mSucc;
+		}
+
+		signed char mark = node->second.mCutTreeMark;
+		for(std::size_t i = first; i < mCutTreeMarked.size(); i++) {
+			mCutTreeMarked[i]->second.mCutTreeMark = mark;
+		}
+		return mark > 0;
+	}
+
+	template<class Settings>
+		void EQModule<Settings>::P_proof_forest_reconnect(g_iterator cutRoot, g_iterator target)
+	{
+		// the path found by the bfs leaves the tree rooted in cutRoot at some edge; this edge becomes part of the forest
+		bool inCutTree = P_proof_forest_in_cut_tree(target, cutRoot);
+		g_iterator current = target;
+
+		for(;;) {
+			edge_info *cur = current->second.mPred;
+			assert(cur != nullptr);
+			bool predInCutTree = P_proof_forest_in_cut_tree(cur->mPred, cutRoot);
+
+			if(predInCutTree != inCutTree) {
+				P_proof_forest_link(inCutTree ? cur->mOther : cur);
+				break;
+			}
+
+			current = cur->mPred;
+		}
+
+		for(g_iterator node : mCutTreeMarked) {
+			node->second.mCutTreeMark = 0;
+		}
+		mCutTreeMarked.clear();
 	}
 	
 	template<class Settings>
@@ -1279,6 +1376,54 @@ namespace smtrat {
 		}
 	}
 
+	template<typename Settings>
+		void EQModule<Settings>::P_add_proof_forest_path_to_infeasible(g_iterator start, g_iterator target, FormulaSetT& infeasible, bool negated)
+	{
+		// mark the path from start to the root; the first marked node on the path from target is the nearest common ancestor
+		for(g_iterator current = start; ; current = current->second.mProofEdge->mSucc) {
+			current->second.mVisited = true;
+			mEqualityComponent.push_back(current);
+			if(current->second.mProofEdge == nullptr) break;
+		}
+
+		g_iterator ancestor = target;
+		while(!ancestor->second.mVisited) {
+			edge_info *cur = ancestor->second.mProofEdge;
+			assert(cur != nullptr);
+			assert(pReceivedFormula()->contains(cur->mFormula));
+
+			infeasible.insert(negated ? FormulaT(carl::NOT, cur->mFormula) : cur->mFormula);
+			ancestor = cur->mSucc;
+		}
+
+		for(g_iterator current = start; current != ancestor; current = current->second.mProofEdge->mSucc) {
+			edge_info *cur = current->second.mProofEdge;
+			assert(pReceivedFormula()->contains(cur->mFormula));
+
+			infeasible.insert(negated ? FormulaT(carl::NOT, cur->mFormula) : cur->mFormula);
+		}
+
+		P_clear_bfs_markings();
+	}
+
+	template<typename Settings>
+		void EQModule<Settings>::P_explain_explicit(g_iterator start, g_iterator target, FormulaSetT& infeasible, bool negated)
+	{
+		if(Settings::explainByProofForest) {
+			P_add_proof_forest_path_to_infeasible(start, target, infeasible, negated);
+			return;
+		}
+
+		bool foundPath = P_bfs_search_weighted_explicit(start, target);
+		assert(foundPath); (void)foundPath;
+
+		if(negated) {
+			P_add_explicit_path_to_infeasible_neg(start, target, infeasible);
+		} else {
+			P_add_explicit_path_to_infeasible(start, target, infeasible);
+		}
+	}
+
 	template<typename Settings>
 		void EQModule<Settings>::P_construct_proof(FormulaSetT& output, g_iterator start, g_iterator target)
 	{
@@ -1294,10 +1439,7 @@ namespace smtrat {
 			std::size_t index_target = mUnionFind.find(front.second->second.mUFIndex);
 
 			if(index_start == index_target) {
-				bool foundPath = P_bfs_search_weighted_explicit(front.first, front.second);
-				assert(foundPath); (void)foundPath;
-
-				P_add_explicit_path_to_infeasible(front.first, front.second, output);
+				P_explain_explicit(front.first, front.second, output, false);
 			} else {
 				g_iterator start_component = mUnionFind[index_start];
 				g_iterator target_component = mUnionFind[index_target];
@@ -1317,15 +1459,9 @@ namespace smtrat {
 					assert(current_edge != nullptr);
 
 					if(pred_edge == nullptr) {
-						bool foundPath = P_bfs_search_weighted_explicit(current_edge->mRealSucc, front.second);
-						assert(foundPath); (void)foundPath;
-
-						P_add_explicit_path_to_infeasible(current_edge->mRealSucc, front.second, output);
+						P_explain_explicit(current_edge->mRealSucc, front.second, output, false);
 					} else {
-						bool foundPath = P_bfs_search_weighted_explicit(current_edge->mRealSucc, pred_edge->mRealPred);
-						assert(foundPath); (void)foundPath;
-
-						P_add_explicit_path_to_infeasible(current_edge->mRealSucc, pred_edge->mRealPred, output);
+						P_explain_explicit(current_edge->mRealSucc, pred_edge->mRealPred, output, false);
 					}
 
 					if(!current_edge->mIsProven) {
@@ -1356,10 +1492,7 @@ namespace smtrat {
 					current = current_edge->mPred;
 				}
 
-				foundPath = P_bfs_search_weighted_explicit(current_edge->mRealPred, front.first);
-				assert(foundPath); (void)foundPath;
-
-				P_add_explicit_path_to_infeasible(current_edge->mRealPred, front.first, output);
+				P_explain_explicit(current_edge->mRealPred, front.first, output, false);
 			}
 		}
 	}
@@ -1381,10 +1514,7 @@ namespace smtrat {
 			std::size_t index_target = mUnionFind.find(top.second->second.mUFIndex);
 
 			if(index_start == index_target) {
-				bool foundPath = P_bfs_search_weighted_explicit(top.first, top.second);
-				assert(foundPath); (void)foundPath;
-
-				P_add_explicit_path_to_infeasible_neg(top.first, top.second, output);
+				P_explain_explicit(top.first, top.second, output, true);
 			} else {
 				g_iterator start_component = mUnionFind[index_start];
 				g_iterator target_component = mUnionFind[index_target];
@@ -1404,15 +1534,9 @@ namespace smtrat {
 					assert(current_edge != nullptr);
 
 					if(pred_edge == nullptr) {
-						bool foundPath = P_bfs_search_weighted_explicit(current_edge->mRealSucc, top.second);
-						assert(foundPath); (void)foundPath;
-
-						P_add_explicit_path_to_infeasible_neg(current_edge->mRealSucc, top.second, output);
+						P_explain_explicit(current_edge->mRealSucc, top.second, output, true);
 					} else {
-						bool foundPath = P_bfs_search_weighted_explicit(current_edge->mRealSucc, pred_edge->mRealPred);
-						assert(foundPath); (void)foundPath;
-
-						P_add_explicit_path_to_infeasible_neg(current_edge->mRealSucc, pred_edge->mRealPred, output);
+						P_explain_explicit(current_edge->mRealSucc, pred_edge->mRealPred, output, true);
 					}
 
 					if(!current_edge->mIsProven) {
@@ -1443,10 +1567,7 @@ namespace smtrat {
 					current = current_edge->mPred;
 				}
 
-				foundPath = P_bfs_search_weighted_explicit(current_edge->mRealPred, top.first);
-				assert(foundPath); (void)foundPath;
-
-				P_add_explicit_path_to_infeasible_neg(current_edge->mRealPred, top.first, output);
+				P_explain_explicit(current_edge->mRealPred, top.first, output, true);
 			}
 		}
 	}
@@ -65,8 +65,10 @@ namespace smtrat
 						mIneq(module.mIneqEdgeAlloc),
 						mUFIndex(std::numeric_limits<std::size_t>::max()),
 						mArgs(nullptr),
+						mProofEdge(nullptr),
 						mPred(0), mImplicitPred(0),
-						mWeight(0), mVisited(false), mWeightFixed(false)
+						mWeight(0), mVisited(false), mWeightFixed(false),
+						mCutTreeMark(0)
 					{}
 
 					inline ~graph_info();
@@ -139,12 +141,15 @@ namespace smtrat
 
 					args_info *mArgs; ///< Pointer to an args_info datastructure containing arity and arguments. Null if this is not a function instance.
 
+					edge_info *mProofEdge; ///< The explicit edge to the parent in the proof forest. Null if this is the root of its tree.
+
 					// additional infos for bfs or weighted bfs
 					edge_info *mPred;  ///< predecessor for explicit bfs
 					implicit_edge_info *mImplicitPred; ///< predecessor for implicit edge
 					double mWeight;    ///< Weight of path from start to this node; this has to be maximized
 					bool mVisited;     ///< Whether this node was already visited
 					bool mWeightFixed; ///< As soon as the node is popped from queue, the weight will stay fixed
+					signed char mCutTreeMark; ///< While reconnecting the proof forest: 1 if in the cut off tree, -1 if not, 0 if unknown
 
 				private:
 					graph_info(const graph_info&) = delete;
@@ -586,6 +591,7 @@ namespace smtrat
 			function_map_type mFunctionMap; // maps uninterpreted functions to the list of their instances and hash buckets
 			std::vector<variable_type> mVariables; // list of all variables; used in updateModel to assign a sort to value to each variable
 			boost::circular_buffer<g_iterator> mBfsQueue; // queue for breath first search in equality graph
+			component_vector_type mCutTreeMarked; // list of all vertices marked while reconnecting the proof forest
 			boost::circular_buffer<bfs_todo_entry> mImplicitEdgeQueue; // list of pairs of variables for which we still have to prove equality in generation of infeasible subsets
 			std::vector<implicit_edge_info*> mImplicitEdgeIsProvenList; // list of implicit equalities that are already proven during generation of infeasible subset
 			std::size_t mCountNonUEQFormulas; // number of incorrect formulas currently asserted
@@ -626,8 +632,8 @@ namespace smtrat
 			// check and update queue capacities to ensure they are big enough
 			inline void P_check_queue_caps();
 			
-			// add an edge explicitly asserted by the sat module
-			inline void P_add_explicit_edge(g_iterator lhs, g_iterator rhs, const FormulaT& formula);
+			// add an edge explicitly asserted by the sat module, returns the edge from lhs to rhs
+			inline edge_info* P_add_explicit_edge(g_iterator lhs, g_iterator rhs, const FormulaT& formula);
 			
 			// removes and destroys an implicit edge
 			inline void P_destroy_implicit_edge(implicit_edge_info* edge);
@@ -642,8 +648,26 @@ namespace smtrat
              */
 			implicit_edge_info* P_add_implicit_edge(g_iterator lhs, g_iterator rhs, g_iterator real_lhs, g_iterator real_rhs);
 			
-			// removes and destroys an explicit edge
-			inline void P_remove_edge(g_iterator lhs, g_iterator rhs, const FormulaT& formula);
+			// removes and destroys an explicit edge; if it was part of the proof forest, returns the root of the tree that was cut off, otherwise the end of the equality graph
+			inline g_iterator P_remove_edge(g_iterator lhs, g_iterator rhs, const FormulaT& formula);
+
+			// the proof forest contains a spanning tree of every component of explicit edges;
+			// explanations are paths in these trees, and removing an edge that is not part of the forest can not split a component
+
+			// make node the root of its tree in the proof forest
+			inline void P_proof_forest_reroot(g_iterator node);
+
+			// link the trees of the source and the target of edge (which are in different trees) by the edge
+			inline void P_proof_forest_link(edge_info* edge);
+
+			// the root of the tree of node in the proof forest
+			inline g_iterator P_proof_forest_root(g_iterator node);
+
+			// whether node is in the tree rooted in cutRoot; marks all nodes on the way to the root, such that no node is visited twice
+			inline bool P_proof_forest_in_cut_tree(g_iterator node, g_iterator cutRoot);
+
+			// reconnect the tree rooted in cutRoot to the rest of its component, using the path from the last explicit bfs search that ends in target
+			void P_proof_forest_reconnect(g_iterator cutRoot, g_iterator target);
 			
 			/**
 			 * add an inequality edge
@@ -676,6 +700,12 @@ namespace smtrat
 			
 			// add the negated equalities on the path from start to target to infeasible subset
 			void P_add_explicit_path_to_infeasible_neg(g_iterator start, g_iterator target, FormulaSetT& infeasible);
+
+			// add the (negated) equalities on the path from start to target in the proof forest to infeasible subset
+			void P_add_proof_forest_path_to_infeasible(g_iterator start, g_iterator target, FormulaSetT& infeasible, bool negated);
+
+			// add the (negated) equalities explaining that start and target are explicitly equal to infeasible subset
+			inline void P_explain_explicit(g_iterator start, g_iterator target, FormulaSetT& infeasible, bool negated);
 			
 			// construction of infeasible subset 
 			void P_construct_infeasible_subset(g_iterator start, g_iterator target, const FormulaT& inequality);
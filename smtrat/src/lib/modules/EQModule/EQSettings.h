@@ -66,6 +66,9 @@ namespace smtrat
 		/* the maximal number of infeasible subsets constructed in isConsistent */
 		static constexpr std::size_t useMaxInfeasibleSubsets = 8;
 
+		/* explain explicit equalities by their path in the proof forest instead of a weighted bfs preferring active formulas */
+		static constexpr bool explainByProofForest = true;
+
 		/* Flag for visualizing the graph */
 		static constexpr bool visualiseGraphs = false;
 		
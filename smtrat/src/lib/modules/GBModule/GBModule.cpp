@@ -34,7 +34,8 @@ GBModule<Settings>::GBModule( const ModuleInput* const _formula, RuntimeSettings
     mInequalities( this ),
     mStateHistory( ),
     mRecalculateGB(false),
-    mRuntimeSettings(static_cast<GBRuntimeSettings*>(settings))
+    mRuntimeSettings(static_cast<GBRuntimeSettings*>(settings)),
+    mRewriteRulesChanged(false)
 #ifdef SMTRAT_DEVOPTION_Statistics
     ,
     mStats(GBModuleStats::getInstance(Settings::identifier)),
@@ -510,6 +511,7 @@ bool GBModule<Settings>::iterativeVariableRewriting()
     if( gbUpdate )
     {
         mBasis = basis;
+        mRewriteRulesChanged = true;
         saveState();
     }
 
@@ -684,12 +686,12 @@ void GBModule<Settings>::pushBacktrackPoint( ModuleInput::const_iterator btpoint
     if( mStateHistory.empty() )
     {
         // there are no variable rewrite rules, so we can only push our current basis and empty rewrites
-        mStateHistory.emplace_back( mBasis, std::map<carl::Variable, std::pair<TermT, carl::BitVector> >() );
+        mStateHistory.emplace_back( mBasis.snapshot( ), std::make_shared<const groebner::RewriteRules>() );
     }
     else
     {
-        // we save the current basis and the rewrite rules
-        mStateHistory.push_back( GBModuleState<Settings>( mBasis, mRewriteRules ) );
+        // the current state has just been saved, so the new level shares it
+        mStateHistory.push_back( mStateHistory.back( ) );
     }
 
     mBacktrackPoints.push_back( btpoint );
@@ -748,8 +750,9 @@ void GBModule<Settings>::popBacktrackPoint( ModuleInput::const_iterator btpoint
     assert( !mStateHistory.empty( ) );
 
     // Load the state to be restored;
-    mBasis = mStateHistory.back( ).getBasis( );
+    mBasis.restore( mStateHistory.back( ).getBasis( ) );
     mRewriteRules = mStateHistory.back().getRewriteRules();
+    mRewriteRulesChanged = false;
     //assert( mBasis.nrOriginalConstraints( ) == mBacktrackPoints.size( ) - 1 );
 
     if( Settings::checkInequalities != NEVER )
@@ -863,9 +866,14 @@ bool GBModule<Settings>::saveState( )
 {
     assert( mStateHistory.size( ) == mBacktrackPoints.size( ) );
 
-    // TODO fix this copy.
-    mStateHistory.pop_back( );
-    mStateHistory.push_back( GBModuleState<Settings>( mBasis, mRewriteRules ) );
+    // The basis is shared with the state, the rewrite rules are only copied if they have changed.
+    std::shared_ptr<const groebner::RewriteRules> rewrites = mStateHistory.back( ).getSharedRewriteRules( );
+    if( mRewriteRulesChanged )
+    {
+        rewrites = std::make_shared<const groebner::RewriteRules>( mRewriteRules );
+        mRewriteRulesChanged = false;
+    }
+    mStateHistory.back( ) = GBModuleState<Settings>( mBasis.snapshot( ), rewrites );
 
     return true;
 }
@@ -1039,7 +1047,7 @@ void GBModule<Settings>::printStateHistory( )
     for( auto it = mStateHistory.begin( ); it != mStateHistory.end( ); ++it )
     {
         std::cout << (*btp)->formula() << ": ";
-        it->getBasis( ).getIdeal( ).print( );
+        it->getBasis( ).mGb->print( );
         std::cout << "," << std::endl;
         btp++;
     }
@@ -62,7 +62,7 @@ protected:
     InequalitiesTable<Settings> mInequalities;
     /// The vector of backtrack points, which has pointers to received constraints.
     std::vector<ModuleInput::const_iterator> mBacktrackPoints;
-    /// Saves the relevant history to support backtracking
+    /// Saves the relevant history to support backtracking, the states share the unchanged parts of the basis
     std::list<GBModuleState<Settings> > mStateHistory;
     /// After popping in the history, it might be necessary to recalculate. This flag indicates this
     bool mRecalculateGB;
@@ -72,6 +72,8 @@ protected:
     GBRuntimeSettings* mRuntimeSettings;
     /// The rewrite rules for the variables
     groebner::RewriteRules mRewriteRules;
+    /// Whether the rewrite rules have been changed since the last saved state
+    bool mRewriteRulesChanged;
 
     std::map<size_t, carl::Variable> mAdditionalVarMap;
     
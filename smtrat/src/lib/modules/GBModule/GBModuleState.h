@@ -1,39 +1,52 @@
 #pragma once
 
-namespace smtrat 
+#include <memory>
+
+#include "RewriteRules.h"
+
+namespace smtrat
 {
     /**
      * A class to save the current state of a GBModule.
-     * Used for backtracking-support
+     * Used for backtracking-support.
+     * The basis and the rewrite rules are shared with the module and the other states, hence saving a state does not copy them.
      */
     template<typename Settings>
     class GBModuleState
     {
     public:
+        typedef typename Settings::Groebner::Snapshot BasisSnapshot;
+
         GBModuleState( ) :
-        mRewrites()
+        mBasis(), mRewrites( std::make_shared<const groebner::RewriteRules>() )
         {
 
         }
 
-        GBModuleState( const typename Settings::Groebner& basisCalculation, const std::map<carl::Variable, std::pair<TermT, carl::BitVector> >& rewrites ) :
-        mBasis( basisCalculation ), mRewrites(rewrites)
+        GBModuleState( const BasisSnapshot& basis, const std::shared_ptr<const groebner::RewriteRules>& rewrites ) :
+        mBasis( basis ), mRewrites( rewrites )
         {
         }
 
-        const typename Settings::Groebner& getBasis( ) const
+        const BasisSnapshot& getBasis( ) const
         {
             return mBasis;
         }
 
-        const std::map<carl::Variable, std::pair<TermT, carl::BitVector> >& getRewriteRules() const
+        const groebner::RewriteRules& getRewriteRules() const
+        {
+            return *mRewrites;
+        }
+
+        const std::shared_ptr<const groebner::RewriteRules>& getSharedRewriteRules() const
         {
             return mRewrites;
         }
 
     protected:
         ///The state of the basis
-        const typename Settings::Groebner mBasis;
-        const std::map<carl::Variable, std::pair<TermT, carl::BitVector> > mRewrites;
+        BasisSnapshot mBasis;
+        ///The rewrite rules, which are only copied if they change
+        std::shared_ptr<const groebner::RewriteRules> mRewrites;
     };
-}
\ No newline at end of file
+}
@@ -213,6 +213,16 @@ namespace smtrat
 		static const unsigned							 sternBrocotHigherPrecisionFactor		 = 10;
     };
     
+    /**
+     * Like GBSettings5, but computes the Groebner basis with the matrix based F4 procedure instead of Buchberger's.
+     */
+    struct GBSettings5F4 : GBSettings5
+    {
+		static constexpr auto moduleName = "GBModule<GBSettings5F4>";
+        static const unsigned                            identifier                              = 55;
+		typedef carl::GBProcedure<PolynomialWithReasons, carl::F4, carl::StdAdding> Groebner;
+    };
+    
     struct GBSettings41 : GBSettings4
     {
         static const unsigned                            identifier                              = 41;
@@ -359,11 +359,27 @@ namespace smtrat
         mTableau.setBlandsRuleStart( 1000 );//(unsigned) mTableau.columns().size() );
         mTableau.compressRows();
         mCheckedWithBackends = false;
+        if( Settings::Tableau_settings::use_float_simplex )
+        {
+            // Find a promising basis in floating-point arithmetic, which the exact simplex below verifies and repairs.
+            std::pair<size_t,size_t> floatPivots = mTableau.floatingPointSearch();
+            #ifdef SMTRAT_DEVOPTION_Statistics
+            mpStatistics->floatingPointSearch( floatPivots.first, floatPivots.second );
+            #else
+            (void)floatPivots;
+            #endif
+            if( Settings::learn_refinements )
+                processLearnedBounds();
+            if( !mInfeasibleSubsets.empty() )
+                return processResult( UNSAT );
+        }
         for( ; ; )
         {
             // Check whether a module which has been called on the same instance in parallel, has found an answer.
             if( anAnswerFound() )
                 return processResult( UNKNOWN );
+            // Store the rows consecutively again, if pivoting has scattered them.
+            mTableau.compressEntries();
             // Find a pivoting element in the tableau.
             std::pair<EntryID,bool> pivotingElement = mTableau.nextPivotingElement();
             #ifdef DEBUG_LRA_MODULE
@@ -24,6 +24,8 @@ namespace smtrat
         size_t mChecks;
         size_t mAllChecksSizes;
         size_t mUnequalConstrainSplittings;
+        size_t mFloatPivotingSteps;
+        size_t mFloatBasisPivotingSteps;
     public:
         // Override Statistics::collect.
         void collect()
@@ -43,6 +45,8 @@ namespace smtrat
            Statistics::addKeyValuePair( "checks-with-pivots", mChecksWithPivoting );
            Statistics::addKeyValuePair( "average-check-size", mChecks == 0 ? 0 : (double)mAllChecksSizes/(double)mChecks );
            Statistics::addKeyValuePair( "unequal-constraint-splittings", mUnequalConstrainSplittings );
+           Statistics::addKeyValuePair( "float-pivots", mFloatPivotingSteps );
+           Statistics::addKeyValuePair( "float-basis-pivots", mFloatBasisPivotingSteps );
         }
         
         void pivotStep()
@@ -51,6 +55,14 @@ namespace smtrat
             ++mCurrentPivotingSteps;
         }
         
+        void floatingPointSearch( size_t _floatPivots, size_t _exactPivots )
+        {
+            mFloatPivotingSteps += _floatPivots;
+            mFloatBasisPivotingSteps += _exactPivots;
+            mPivotingSteps += _exactPivots;
+            mCurrentPivotingSteps += _exactPivots;
+        }
+        
         void check( const ModuleInput& _formula )
         {
             if( mCurrentPivotingSteps > 0 )
@@ -126,7 +138,9 @@ namespace smtrat
             mTheoryPropagations( 0 ),
             mChecks( 0 ),
             mAllChecksSizes( 0 ),
-            mUnequalConstrainSplittings( 0 )
+            mUnequalConstrainSplittings( 0 ),
+            mFloatPivotingSteps( 0 ),
+            mFloatBasisPivotingSteps( 0 )
         {}
         
         ~LRAModuleStatistics() {}
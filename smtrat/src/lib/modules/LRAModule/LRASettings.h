@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "../../datastructures/lra/Numeric.h"
 #include "../../datastructures/lra/TableauSettings.h"
 #include "../../solver/ModuleSettings.h"
 
@@ -35,19 +36,11 @@ namespace smtrat
         /**
          *
          */
-        #ifdef SMTRAT_STRAT_PARALLEL_MODE
-        typedef Rational BoundType;
-        #else
-        typedef carl::Numeric<Rational> BoundType;
-        #endif
+        typedef lra::Numeric BoundType;
         /**
          *
          */
-        #ifdef SMTRAT_STRAT_PARALLEL_MODE
-        typedef Rational EntryType;
-        #else
-        typedef carl::Numeric<Rational> EntryType;
-        #endif
+        typedef lra::Numeric EntryType;
         /**
          *
          */
@@ -65,6 +58,12 @@ namespace smtrat
         struct Tableau_settings : lra::TableauSettings3 {};
     };
     
+    struct LRASettingsFloat : LRASettings1
+    {
+		static constexpr auto moduleName = "LRAModule<LRASettingsFloat>";
+        struct Tableau_settings : lra::TableauSettingsFloat {};
+    };
+    
     struct LRASettingsICP : LRASettings1
     {
 		static constexpr auto moduleName = "LRAModule<LRASettingsICP>";
@@ -19,7 +19,9 @@ namespace smtrat
 #endif
 		mCAD(),
 		mReplacer(mCAD)
-	{}
+	{
+		mCAD.setInterrupts(answerFound());
+	}
 	
 	template<class Settings>
 	NewCADModule<Settings>::~NewCADModule()
@@ -91,6 +93,10 @@ namespace smtrat
 		auto answer = mCAD.check(mLastAssignment, mInfeasibleSubsets);
 #ifdef SMTRAT_DEVOPTION_Statistics
 		mStatistics.currentProjectionSize(mCAD.getProjection().size());
+		const auto& projectionOperator = mCAD.getProjection().projectionOperator();
+		mStatistics.projectionCache(projectionOperator.cacheHits(), projectionOperator.cacheMisses(), cad::ProjectionCache::getInstance().size());
+		const auto& comparisons = cad::RANComparisonCounters::getInstance();
+		mStatistics.ranComparisons(comparisons.numeric.load(), comparisons.approximation.load(), comparisons.interval.load(), comparisons.exact.load());
 #endif
 		if (answer == Answer::UNSAT) {
 			//mCAD.generateInfeasibleSubsets(mInfeasibleSubsets);
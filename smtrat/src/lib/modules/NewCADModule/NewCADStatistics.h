@@ -17,14 +17,42 @@ namespace smtrat
 	class NewCADStatistics : public Statistics {
 	private:
 		std::size_t mMaxProjectionSize = 0;
+		std::size_t mProjectionCacheHits = 0;
+		std::size_t mProjectionCacheMisses = 0;
+		std::size_t mProjectionCacheSize = 0;
+		std::size_t mRANComparisonsNumeric = 0;
+		std::size_t mRANComparisonsApproximation = 0;
+		std::size_t mRANComparisonsInterval = 0;
+		std::size_t mRANComparisonsExact = 0;
 	public:
 		void collect()
 		{
 		   Statistics::addKeyValuePair("max_projection_size", mMaxProjectionSize);
+		   Statistics::addKeyValuePair("projection_cache_hits", mProjectionCacheHits);
+		   Statistics::addKeyValuePair("projection_cache_misses", mProjectionCacheMisses);
+		   Statistics::addKeyValuePair("projection_cache_hitrate", mProjectionCacheHits + mProjectionCacheMisses == 0 ? 0.0 : (double)mProjectionCacheHits / (double)(mProjectionCacheHits + mProjectionCacheMisses));
+		   Statistics::addKeyValuePair("projection_cache_size", mProjectionCacheSize);
+		   Statistics::addKeyValuePair("ran_comparisons_numeric", mRANComparisonsNumeric);
+		   Statistics::addKeyValuePair("ran_comparisons_approximation", mRANComparisonsApproximation);
+		   Statistics::addKeyValuePair("ran_comparisons_interval", mRANComparisonsInterval);
+		   Statistics::addKeyValuePair("ran_comparisons_exact", mRANComparisonsExact);
 		}
 		void currentProjectionSize(std::size_t size) {
 			mMaxProjectionSize = std::max(mMaxProjectionSize, size);
 		}
+		/// The hits and misses of the projection of this module and the size of the projection cache shared by all instances.
+		void projectionCache(std::size_t hits, std::size_t misses, std::size_t size) {
+			mProjectionCacheHits = hits;
+			mProjectionCacheMisses = misses;
+			mProjectionCacheSize = size;
+		}
+		/// The comparisons of sample values are counted globally, hence the global counters are reported.
+		void ranComparisons(std::size_t numeric, std::size_t approximation, std::size_t interval, std::size_t exact) {
+			mRANComparisonsNumeric = numeric;
+			mRANComparisonsApproximation = approximation;
+			mRANComparisonsInterval = interval;
+			mRANComparisonsExact = exact;
+		}
 		NewCADStatistics( const std::string& _statisticName ):
 			Statistics( _statisticName, this )
 		{}
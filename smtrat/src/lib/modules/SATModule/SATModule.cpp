@@ -26,6 +26,7 @@
  */
 
 #include "SATModule.h"
+#include "../../solver/Manager.h"
 #include <iomanip>
 
 #ifdef LOGGING
@@ -98,12 +99,16 @@ namespace smtrat
         cla_inc( 1 ),
         var_inc( 1 ),
         watches( WatcherDeleted( ca ) ),
+        watchesBin( WatcherDeleted( ca ) ),
         qhead( 0 ),
         simpDB_assigns( -1 ),
         simpDB_props( 0 ),
         order_heap( VarOrderLt( activity ) ),
         progress_estimate( 0 ),
         remove_satisfied( Settings::remove_satisfied ),
+        lbd_stamp( 0 ),
+        mNextInprocessing( Settings::inprocessing_interval ),
+        preprocess_effort( 0 ),
         // Resource constraints:
         conflict_budget( -1 ),
         propagation_budget( -1 ),
@@ -116,6 +121,23 @@ namespace smtrat
         mExcludedAssignments( false ),
         mCurrentAssignmentConsistent( SAT ),
         mNumberOfFullLazyCalls( 0 ),
+        mTheoryCallScheduler( Settings::theory_call_budget, Settings::theory_call_max_interval ),
+        mSharedClauses(),
+        mCubeWorkers(),
+        mCubeDecided( false ),
+        mpSharedClauses( nullptr ),
+        mWorkerId( 0 ),
+        mImportedSharedClauses( 0 ),
+        mAssumptionsBeforeCube( -1 ),
+        mSolvedByCube( false ),
+        mCubeModel(),
+        mPreprocessed( false ),
+        mPreprocessingTrail( -1 ),
+        mEliminatedClauses(),
+        mResolvents(),
+        mEliminatedVars(),
+        mPreprocessedVars(),
+        mPreprocessedClauses( 0 ),
         mCurr_Restarts( 0 ),
         mNumberOfTheoryCalls( 0 ),
         mReceivedFormulaPurelyPropositional(true),
@@ -125,6 +147,10 @@ namespace smtrat
         mFormulaAssumptionMap(),
         mFormulaCNFInfosMap(),
         mClauseInformation(),
+        mLearntOrigins(),
+        mExplanationCache(),
+        mExplanationLru(),
+        mExplanationClauses(),
         mLiteralClausesMap(),
         mNumberOfSatisfiedClauses( 0 ),
         mChangedBooleans(),
@@ -202,6 +228,8 @@ namespace smtrat
     template<class Settings>
     bool SATModule<Settings>::addCore( ModuleInput::const_iterator _subformula )
     {
+        for( SATModule<Settings>* worker : mCubeWorkers )
+            worker->add( _subformula );
         if( _subformula->formula().isFalse() )
         {
             mModelComputed = false;
@@ -212,6 +240,7 @@ namespace smtrat
         }
         else if( !_subformula->formula().isTrue() )
         {
+            int firstClause = clauses.size();
             if( !_subformula->formula().isOnlyPropositional() )
                 mReceivedFormulaPurelyPropositional = false;
             mModelComputed = false;
@@ -229,6 +258,9 @@ namespace smtrat
             {
                 addClauses( _subformula->formula(), NORMAL_CLAUSE, 0, _subformula->formula() );
             }
+            // the preprocessing stays valid, unless the new clauses contain eliminated variables or unblock eliminated clauses
+            if( Settings::preprocessing && mPreprocessed && touchesPreprocessing( firstClause ) )
+                restorePreprocessing( false );
             if ( isLemmaLevel(NORMAL) && decisionLevel() == 0)
             {
                 if (_subformula->formula().propertyHolds(carl::PROP_IS_A_LITERAL) && _subformula->formula().propertyHolds(carl::PROP_CONTAINS_BOOLEAN))
@@ -254,18 +286,37 @@ namespace smtrat
     template<class Settings>
     void SATModule<Settings>::removeCore( ModuleInput::const_iterator _subformula )
     {
+        for( SATModule<Settings>* worker : mCubeWorkers )
+            worker->remove( _subformula );
+        if( !mCubeWorkers.empty() )
+        {
+            // the shared clauses might have been derived from the removed formula, the imported ones have been removed by the workers
+            mSharedClauses.mClauses.clear();
+            for( SATModule<Settings>* worker : mCubeWorkers )
+                worker->mImportedSharedClauses = 0;
+        }
         if( _subformula->formula().isFalse() || _subformula->formula().isTrue() )
             return;
         cancelUntil( 0, true );  // can we do better than this?
+        if( Settings::preprocessing && (mPreprocessed || mPreprocessingTrail >= 0) )
+            restorePreprocessing( true );
         if( !mReceivedFormulaPurelyPropositional )
             adaptPassedFormula();
         assert( rPassedFormula().empty() );
-        for( int i = 0; i < learnts.size(); ++i )
+        // Only remove the learnt clauses, which have been derived from the formula to remove.
+        int i, j;
+        for( i = j = 0; i < learnts.size(); ++i )
         {
             assert( learnts[i] != CRef_Undef );
-            removeClause( learnts[i] );
+            if( !Settings::keep_learnts_on_remove || learntDependsOn( learnts[i], _subformula->formula() ) )
+                removeClause( learnts[i] );
+            else
+                learnts[j++] = learnts[i];
         }
-        learnts.clear();
+        #ifdef SMTRAT_DEVOPTION_Statistics
+        mpStatistics->learntsOnRemove( (size_t) j, (size_t) (i - j) );
+        #endif
+        learnts.shrink( i - j );
         ok = true;
         if( _subformula->formula().propertyHolds( carl::PROP_IS_A_LITERAL ) )
         {
@@ -385,6 +436,12 @@ namespace smtrat
         learntsize_adjust_confl = learntsize_adjust_start_confl;
         learntsize_adjust_cnt = (int)learntsize_adjust_confl;
 
+        // the preprocessing relies on the clauses being attached, which does not hold if the satisfied clauses are counted;
+        // once undone, it is only repeated after the number of problem clauses has grown by half
+        if( Settings::preprocessing && !Settings::check_if_all_clauses_are_satisfied && ok && !mPreprocessed && !mMinimizingCheck
+            && (mPreprocessedClauses == 0 || 2 * clauses.size() >= 3 * mPreprocessedClauses) )
+            preprocess();
+
         if( !ok )
         {
             assert( !mInfeasibleSubsets.empty() );
@@ -437,7 +494,11 @@ namespace smtrat
         }
         lbool result = l_Undef;
         mUpperBoundOnMinimal = passedFormulaEnd();
-        while( true )
+        mSolvedByCube = false;
+        if( Settings::cube_and_conquer && !mMinimizingCheck && !isLemmaLevel(LemmaLevel::ADVANCED) )
+            result = cubeAndConquer();
+        // if the cubes did not decide the received formula, we search on our own
+        while( result == l_Undef || mMinimizingCheck )
         {
             if( Settings::use_restarts )
             {
@@ -568,6 +629,250 @@ namespace smtrat
         }
     }
 
+    template<class Settings>
+    Minisat::lbool SATModule<Settings>::cubeAndConquer()
+    {
+        SMTRAT_TRACE_SPAN( "sat", "SATModule::cubeAndConquer" );
+        // workers do not split their cubes again
+        if( mpSharedClauses != nullptr || mpManager == nullptr )
+            return l_Undef;
+        // the cubes consist of the most active decision variables abstracting received Booleans or constraints
+        std::vector<std::pair<Var,FormulaT>> candidates;
+        for( Var v = 0; v < nVars(); ++v )
+        {
+            if( !decision[v] || (value( v ) != l_Undef && level( v ) == 0) )
+                continue;
+            if( mBooleanConstraintMap[v].first != nullptr )
+                candidates.emplace_back( v, mBooleanConstraintMap[v].first->reabstraction );
+            else
+            {
+                auto mvIter = mMinisatVarMap.find( (int) v );
+                if( mvIter != mMinisatVarMap.end() )
+                    candidates.emplace_back( v, mvIter->second );
+            }
+        }
+        size_t depth = std::min( (size_t) Settings::cube_depth, candidates.size() );
+        if( depth == 0 )
+            return l_Undef;
+        std::partial_sort( candidates.begin(), candidates.begin() + (long) depth, candidates.end(),
+            [this]( const std::pair<Var,FormulaT>& a, const std::pair<Var,FormulaT>& b ) { return activity[a.first] > activity[b.first]; } );
+        std::vector<FormulasT> cubes;
+        for( size_t mask = 0; mask < ((size_t) 1 << depth); ++mask )
+        {
+            FormulasT cube;
+            for( size_t i = 0; i < depth; ++i )
+                cube.push_back( ((mask >> i) & 1) ? candidates[i].second : FormulaT( carl::FormulaType::NOT, candidates[i].second ) );
+            cubes.push_back( std::move( cube ) );
+        }
+        // create the workers, which only run in parallel if carl's pools are thread safe
+        #if defined SMTRAT_STRAT_PARALLEL_MODE && defined THREAD_SAFE
+        size_t numberOfWorkers = std::min( (size_t) std::max( Settings::cube_workers, 1u ), cubes.size() );
+        #else
+        size_t numberOfWorkers = 1;
+        #endif
+        while( mCubeWorkers.size() < numberOfWorkers )
+        {
+            Conditionals foundAnswer( answerFound() );
+            foundAnswer.push_back( &mCubeDecided );
+            Module* worker = cloneModule( foundAnswer );
+            if( worker == nullptr )
+                break;
+            // the clone is of the same type, as it is created by the same factory
+            SATModule<Settings>* satWorker = static_cast<SATModule<Settings>*>( worker );
+            satWorker->mpSharedClauses = &mSharedClauses;
+            satWorker->mWorkerId = mCubeWorkers.size();
+            mCubeWorkers.push_back( satWorker );
+        }
+        if( mCubeWorkers.empty() )
+            return l_Undef;
+        // solve the cubes
+        mCubeDecided = false;
+        std::atomic<size_t> nextCube( 0 );
+        std::atomic<size_t> solvedCubes( 0 );
+        std::atomic<bool> cubeUnknown( false );
+        std::atomic<bool> refuted( false );
+        std::mutex solutionMutex;
+        SATModule<Settings>* solution = nullptr;
+        auto work = [&]( SATModule<Settings>* _worker )
+        {
+            for( size_t c = nextCube++; c < cubes.size() && !mCubeDecided; c = nextCube++ )
+            {
+                lbool cubeResult = _worker->checkCube( cubes[c], mFullCheck );
+                if( cubeResult == l_True )
+                {
+                    std::lock_guard<std::mutex> lock( solutionMutex );
+                    if( solution == nullptr )
+                        solution = _worker;
+                    mCubeDecided = true;
+                    // keep the assignment of the solution
+                    return;
+                }
+                if( cubeResult == l_False && !_worker->ok )
+                {
+                    // the received formula itself is unsatisfiable
+                    refuted = true;
+                    mCubeDecided = true;
+                }
+                else if( cubeResult == l_Undef )
+                    cubeUnknown = true;
+                else
+                    ++solvedCubes;
+                _worker->endCube();
+            }
+        };
+        #if defined SMTRAT_STRAT_PARALLEL_MODE && defined THREAD_SAFE
+        std::vector<std::thread> threads;
+        for( size_t i = 1; i < mCubeWorkers.size(); ++i )
+            threads.emplace_back( work, mCubeWorkers[i] );
+        work( mCubeWorkers.front() );
+        for( auto& thread : threads )
+            thread.join();
+        #else
+        work( mCubeWorkers.front() );
+        #endif
+        lbool result = l_Undef;
+        if( solution != nullptr )
+        {
+            solution->mModelComputed = false;
+            solution->updateModel();
+            mCubeModel = solution->mModel;
+            mSolvedByCube = true;
+            result = l_True;
+        }
+        // an unknown cube leaves the clauses excluding its theory assignments in the worker, which later cubes of this
+        // worker might be refuted by, hence no refutation is trusted after an unknown cube
+        else if( !cubeUnknown && (refuted || nextCube >= cubes.size()) )
+            result = l_False;
+        for( SATModule<Settings>* worker : mCubeWorkers )
+            worker->endCube();
+        #ifdef SMTRAT_DEVOPTION_Statistics
+        mpStatistics->cubes( cubes.size(), solvedCubes );
+        #endif
+        return result;
+    }
+
+    template<class Settings>
+    Minisat::lbool SATModule<Settings>::checkCube( const FormulasT& _cube, bool _full )
+    {
+        SMTRAT_TRACE_SPAN( "sat", "SATModule::checkCube" );
+        mFinalCheck = true;
+        mFullCheck = _full;
+        mMinimizingCheck = false;
+        clearLemmas();
+        ScopedBool scopedBool( mBusy, true );
+        budgetOff();
+        Module::init();
+        processLemmas();
+        importSharedClauses();
+        max_learnts = (nAssigns() + nClauses() + nLearnts() ) * learntsize_factor;
+        learntsize_adjust_confl = learntsize_adjust_start_confl;
+        learntsize_adjust_cnt = (int)learntsize_adjust_confl;
+        mAssumptionsBeforeCube = assumptions.size();
+        if( !ok )
+            return l_False;
+        mReceivedFormulaPurelyPropositional = rReceivedFormula().isOnlyPropositional();
+        mUpperBoundOnMinimal = passedFormulaEnd();
+        // literals unknown to this worker are left out, which only enlarges the cube
+        for( const FormulaT& literal : _cube )
+        {
+            Lit l = findLiteral( literal );
+            if( l != lit_Undef )
+                assumptions.push( l );
+        }
+        lbool result = checkFormula();
+        if( !Settings::stop_search_after_first_unknown )
+            mExcludedAssignments = false;
+        return result;
+    }
+
+    template<class Settings>
+    void SATModule<Settings>::endCube()
+    {
+        if( mAssumptionsBeforeCube < 0 )
+            return;
+        cancelUntil( 0, true );
+        assumptions.shrink( assumptions.size() - mAssumptionsBeforeCube );
+        mAssumptionsBeforeCube = -1;
+    }
+
+    template<class Settings>
+    void SATModule<Settings>::exportSharedClause( const vec<Lit>& _clause )
+    {
+        // clauses learnt from excluded assignments are no consequences of the received formula
+        if( mExcludedAssignments || unknown_excludes.size() > 0 )
+            return;
+        FormulasT subformulas;
+        for( int i = 0; i < _clause.size(); ++i )
+        {
+            Var v = var( _clause[i] );
+            FormulaT atom;
+            if( mBooleanConstraintMap[v].first != nullptr )
+                atom = mBooleanConstraintMap[v].first->reabstraction;
+            else
+            {
+                auto mvIter = mMinisatVarMap.find( (int) v );
+                if( mvIter == mMinisatVarMap.end() )
+                    return;
+                atom = mvIter->second;
+            }
+            subformulas.push_back( sign( _clause[i] ) ? FormulaT( carl::FormulaType::NOT, atom ) : atom );
+        }
+        FormulaT clause( carl::FormulaType::OR, std::move( subformulas ) );
+        std::lock_guard<std::mutex> lock( mpSharedClauses->mMutex );
+        mpSharedClauses->mClauses.emplace_back( mWorkerId, clause );
+        #ifdef SMTRAT_DEVOPTION_Statistics
+        mpStatistics->sharedClauseExported();
+        #endif
+    }
+
+    template<class Settings>
+    void SATModule<Settings>::importSharedClauses()
+    {
+        if( mpSharedClauses == nullptr )
+            return;
+        FormulasT clauses;
+        {
+            std::lock_guard<std::mutex> lock( mpSharedClauses->mMutex );
+            for( ; mImportedSharedClauses < mpSharedClauses->mClauses.size(); ++mImportedSharedClauses )
+            {
+                const auto& sharedClause = mpSharedClauses->mClauses[mImportedSharedClauses];
+                if( sharedClause.first != mWorkerId )
+                    clauses.push_back( sharedClause.second );
+            }
+        }
+        for( const FormulaT& clause : clauses )
+        {
+            // a shared clause might have been simplified to a literal, which would be added as assumption
+            if( clause.getType() != carl::FormulaType::OR )
+                continue;
+            int firstLemma = mLemmas.size();
+            addClauses( clause, LEMMA_CLAUSE );
+            for( int i = firstLemma; i < mLemmasDependOnAll.size(); ++i )
+                mLemmasDependOnAll[i] = true;
+            #ifdef SMTRAT_DEVOPTION_Statistics
+            mpStatistics->sharedClauseImported();
+            #endif
+        }
+    }
+
+    template<class Settings>
+    Lit SATModule<Settings>::findLiteral( const FormulaT& _formula ) const
+    {
+        bool negated = _formula.getType() == carl::FormulaType::NOT;
+        const FormulaT& content = negated ? _formula.subformula() : _formula;
+        if( content.getType() == carl::FormulaType::BOOL )
+        {
+            BooleanVarMap::const_iterator booleanVarPair = mBooleanVarMap.find( content.boolean() );
+            if( booleanVarPair == mBooleanVarMap.end() )
+                return lit_Undef;
+            return mkLit( booleanVarPair->second, negated );
+        }
+        ConstraintLiteralsMap::const_iterator constraintLiteralPair = mConstraintLiteralMap.find( content );
+        if( constraintLiteralPair == mConstraintLiteralMap.end() )
+            return lit_Undef;
+        return negated ? neg( constraintLiteralPair->second.front() ) : constraintLiteralPair->second.front();
+    }
+
     template<class Settings>
     void SATModule<Settings>::computeAdvancedLemmas()
     {
@@ -662,7 +967,9 @@ namespace smtrat
         if( !mModelComputed && !mOptimumComputed )
         {
             clearModel();
-            if( solverState() != UNSAT || mMinimizingCheck )
+            if( mSolvedByCube )
+                mModel = mCubeModel;
+            else if( solverState() != UNSAT || mMinimizingCheck )
             {
                 for( BooleanVarMap::const_iterator bVar = mBooleanVarMap.begin(); bVar != mBooleanVarMap.end(); ++bVar )
                 {
@@ -1553,6 +1860,8 @@ namespace smtrat
         int v = nVars();
         watches.init( mkLit( v, false ) );
         watches.init( mkLit( v, true ) );
+        watchesBin.init( mkLit( v, false ) );
+        watchesBin.init( mkLit( v, true ) );
         assigns.push( l_Undef );
         vardata.push( VarData( CRef_Undef, -1, -1 ) );
         activity.push( _activity == numeric_limits<double>::infinity() ? maxActivity() + 1 : _activity );
@@ -1603,6 +1912,7 @@ namespace smtrat
         {
             Lit p;
             int i, j;
+            bool levelZeroOmitted = false;
             for( i = j = 0, p = lit_Undef; i < add_tmp.size(); ++i )
             {
                 // tautologies are ignored
@@ -1618,7 +1928,10 @@ namespace smtrat
                 if( value( add_tmp[i] ) == l_False )
                 {
                     if( level( var( add_tmp[i] ) ) == 0 )
+                    {
+                        levelZeroOmitted = levelZeroOmitted || var( add_tmp[i] ) != mTrueVar;
                         continue;
+                    }
                     else
                         ++falseLiteralsCount; // if we decide to keep it, we count it into the false literals
                 }
@@ -1634,6 +1947,7 @@ namespace smtrat
                 mLemmas.push();
                 add_tmp.copyTo( mLemmas.last() );
                 mLemmasRemovable.push( _type != NORMAL_CLAUSE );
+                mLemmasDependOnAll.push( levelZeroOmitted );
                 return true;
             }
             // if all false, we're in conflict
@@ -1761,7 +2075,28 @@ namespace smtrat
             {
                 lemma_ref = ca.alloc( lemma, removable );
                 if( removable )
+                {
                     learnts.push( lemma_ref );
+                    if( Settings::cache_theory_explanations )
+                    {
+                        // a theory propagation with the same explanation reuses this lemma
+                        auto cacheIter = explanationCacheEntry( lemma );
+                        if( cacheIter->second.mClause == CRef_Undef )
+                        {
+                            cacheIter->second.mClause = lemma_ref;
+                            mExplanationClauses[lemma_ref] = cacheIter;
+                        }
+                    }
+                    // lemmas are valid in the theory, unless they are relative to an upper bound on the objective, literals
+                    // assigned at decision level 0 have been omitted or they have been imported, whose derivation is not traced here
+                    if( Settings::keep_learnts_on_remove && (mUpperBoundOnMinimal != passedFormulaEnd() || mLemmasDependOnAll[i]) )
+                    {
+                        std::vector<FormulaT> origins;
+                        if( mLemmasDependOnAll[i] )
+                            origins.push_back( FormulaT( carl::FormulaType::FALSE ) );
+                        storeLearntOrigins( lemma_ref, origins );
+                    }
+                }
                 else
                     clauses.push( lemma_ref );
                 attachClause( lemma_ref );
@@ -1801,6 +2136,7 @@ namespace smtrat
         // clear the lemmas
         mLemmas.clear();
         mLemmasRemovable.clear();
+        mLemmasDependOnAll.clear();
 		SMTRAT_LOG_DEBUG("smtrat.sat", "Stored lemmas, returning conflict " << conflict);
         return conflict;
     }
@@ -1810,8 +2146,9 @@ namespace smtrat
     {
         Clause& c = ca[cr];
         assert( c.size() > 1 );
-        watches[~c[0]].push( Watcher( cr, c[1] ) );
-        watches[~c[1]].push( Watcher( cr, c[0] ) );
+        OccLists<Lit, vec<Watcher>, WatcherDeleted>& ws = c.size() == 2 ? watchesBin : watches;
+        ws[~c[0]].push( Watcher( cr, c[1] ) );
+        ws[~c[1]].push( Watcher( cr, c[0] ) );
         if( c.learnt() )
         {
             learnts_literals += (uint64_t)c.size();
@@ -1845,17 +2182,18 @@ namespace smtrat
     {
         const Clause& c = ca[cr];
         assert( c.size() > 1 );
+        OccLists<Lit, vec<Watcher>, WatcherDeleted>& ws = c.size() == 2 ? watchesBin : watches;
 
         if( strict )
         {
-            Minisat::remove( watches[~c[0]], Watcher( cr, c[1] ) );
-            Minisat::remove( watches[~c[1]], Watcher( cr, c[0] ) );
+            Minisat::remove( ws[~c[0]], Watcher( cr, c[1] ) );
+            Minisat::remove( ws[~c[1]], Watcher( cr, c[0] ) );
         }
         else
         {
             // Lazy detaching: (NOTE! Must clean all watcher lists before garbage collecting this clause)
-            watches.smudge( ~c[0] );
-            watches.smudge( ~c[1] );
+            ws.smudge( ~c[0] );
+            ws.smudge( ~c[1] );
         }
 
         if( c.learnt() )
@@ -1894,10 +2232,21 @@ namespace smtrat
     void SATModule<Settings>::removeClause( CRef cr )
     {
         Clause& c = ca[cr];
+        if( Settings::keep_learnts_on_remove && c.learnt() )
+            mLearntOrigins.erase( cr );
+        if( Settings::cache_theory_explanations && c.learnt() )
+        {
+            auto ecIter = mExplanationClauses.find( cr );
+            if( ecIter != mExplanationClauses.end() )
+            {
+                ecIter->second->second.mClause = CRef_Undef;
+                mExplanationClauses.erase( ecIter );
+            }
+        }
         detachClause( cr );
         // Don't leave pointers to free'd memory!
         if( locked( c ) )
-            vardata[var( c[0] )].reason = CRef_Undef;
+            vardata[var( c[reasonPosition( c )] )].reason = CRef_Undef;
         c.mark( 1 );
         ca.free( cr );
     }
@@ -2178,6 +2527,21 @@ namespace smtrat
         // remove theory propagation
         removeTheoryPropagation( vd.mExpPos );
 
+        // look up the explanation of this theory propagation
+        auto cacheIter = mExplanationCache.end();
+        if( Settings::cache_theory_explanations )
+        {
+            cacheIter = explanationCacheEntry( explanation );
+            if( cacheIter->second.mClause != CRef_Undef && reuseExplanation( cacheIter->second.mClause, l ) )
+            {
+                #ifdef SMTRAT_DEVOPTION_Statistics
+                mpStatistics->explanationReused();
+                #endif
+                vardata[x] = VarData( cacheIter->second.mClause, level(x), trailIndex(x) );
+                return cacheIter->second.mClause;
+            }
+        }
+
         // sort the literals by trail index level
         lemma_lt lt(*this);
         sort( explanation, lt );
@@ -2186,6 +2550,7 @@ namespace smtrat
         // compute the assertion level for this clause
         int i, j;
         Lit prev = lit_Undef;
+        bool levelZeroOmitted = false;
         for( i = 0, j = 0; i < explanation.size(); ++i )
         {
             assert( value(explanation[i]) != l_Undef );
@@ -2202,7 +2567,10 @@ namespace smtrat
                 continue;
             // ignore zero level literals
             if( level(var(explanation[i])) == 0 )
+            {
+                levelZeroOmitted = levelZeroOmitted || var(explanation[i]) != mTrueVar;
                 continue;
+            }
             // keep this literal
             prev = explanation[j++] = explanation[i];
         }
@@ -2215,14 +2583,102 @@ namespace smtrat
             explanation.push( mkLit( mTrueVar, true ) );
         }
 
-        // construct the reason
+        // construct the reason (it is a theory lemma and hence does not depend on any received formula, unless literals
+        // assigned at decision level 0 have been omitted, whose derivation is not traced during the conflict analysis)
         CRef real_reason = ca.alloc( explanation, LEMMA_CLAUSE );
         vardata[x] = VarData( real_reason, level(x), trailIndex(x) );
         learnts.push(real_reason);
+        if( Settings::keep_learnts_on_remove && levelZeroOmitted )
+            mLearntOrigins[real_reason] = std::vector<FormulaT>( 1, FormulaT( carl::FormulaType::FALSE ) );
         attachClause(real_reason);
+        if( cacheIter != mExplanationCache.end() )
+            cacheExplanation( cacheIter, real_reason );
         return real_reason;
     }
 
+    template<class Settings>
+    bool SATModule<Settings>::reuseExplanation( CRef _clause, Lit _lit )
+    {
+        Clause& c = ca[_clause];
+        bool containsLit = false;
+        for( int i = 0; i < c.size(); ++i )
+        {
+            if( c[i] == _lit )
+                containsLit = true;
+            else if( value( c[i] ) != l_False || trailIndex( var( c[i] ) ) >= trailIndex( var( _lit ) ) )
+                return false;
+        }
+        if( !containsLit )
+            return false;
+        // the propagated literal and the latest assigned literals have to be watched
+        detachClause( _clause, true );
+        vec<Lit> lits;
+        for( int i = 0; i < c.size(); ++i )
+            lits.push( c[i] );
+        lemma_lt lt(*this);
+        sort( lits, lt );
+        assert( lits[0] == _lit );
+        for( int i = 0; i < c.size(); ++i )
+            c[i] = lits[i];
+        attachClause( _clause );
+        claBumpActivity( c );
+        return true;
+    }
+
+    template<class Settings>
+    typename SATModule<Settings>::ExplanationCache::iterator SATModule<Settings>::explanationCacheEntry( const vec<Lit>& _lits )
+    {
+        std::vector<int> key;
+        key.reserve( (size_t) _lits.size() );
+        for( int i = 0; i < _lits.size(); ++i )
+            key.push_back( toInt( _lits[i] ) );
+        std::sort( key.begin(), key.end() );
+        key.erase( std::unique( key.begin(), key.end() ), key.end() );
+        auto cacheIter = mExplanationCache.find( key );
+        if( cacheIter != mExplanationCache.end() )
+        {
+            mExplanationLru.splice( mExplanationLru.begin(), mExplanationLru, cacheIter->second.mLruPos );
+            return cacheIter;
+        }
+        if( mExplanationCache.size() >= Settings::explanation_cache_limit )
+        {
+            // forget the least recently used entry, its clause stays a learnt clause
+            auto lruIter = mExplanationCache.find( *mExplanationLru.back() );
+            assert( lruIter != mExplanationCache.end() );
+            if( lruIter->second.mClause != CRef_Undef )
+                mExplanationClauses.erase( lruIter->second.mClause );
+            mExplanationCache.erase( lruIter );
+            mExplanationLru.pop_back();
+        }
+        cacheIter = mExplanationCache.emplace( std::move( key ), ExplanationInfo() ).first;
+        mExplanationLru.push_front( &cacheIter->first );
+        cacheIter->second.mLruPos = mExplanationLru.begin();
+        return cacheIter;
+    }
+
+    template<class Settings>
+    void SATModule<Settings>::cacheExplanation( typename ExplanationCache::iterator _entry, CRef _clause )
+    {
+        ExplanationInfo& info = _entry->second;
+        // the former explanation is still a learnt clause, but not an asserting one anymore
+        if( info.mClause != CRef_Undef )
+            mExplanationClauses.erase( info.mClause );
+        info.mClause = _clause;
+        ++info.mDerivations;
+        mExplanationClauses[_clause] = _entry;
+        if( info.mDerivations > 1 )
+        {
+            // this theory propagation is derived repeatedly, hence keep its explanation
+            Clause& c = ca[_clause];
+            if( c.lbd() > Settings::lbd_core_tier )
+                c.lbd( Settings::lbd_core_tier );
+            claBumpActivity( c );
+            #ifdef SMTRAT_DEVOPTION_Statistics
+            mpStatistics->explanationRederived();
+            #endif
+        }
+    }
+
     template<class Settings>
     void SATModule<Settings>::removeTheoryPropagation( int _position )
     {
@@ -2242,6 +2698,7 @@ namespace smtrat
     template<class Settings>
     void SATModule<Settings>::theoryCall()
     {
+        SMTRAT_TRACE_SPAN( "sat", "SATModule::theoryCall" );
         #ifdef DEBUG_SATMODULE
         cout << "### Sat iteration" << endl;
         cout << "######################################################################" << endl;
@@ -2265,10 +2722,23 @@ namespace smtrat
             bool finalCheck = fullAssignment();
             if( mChangedPassedFormula || finalCheck )
             {
+                const bool adaptive = Settings::theory_call_policy == TheoryCallPolicy::ADAPTIVE;
+                if( adaptive && !finalCheck )
+                {
+                    // the passed formula stays marked as changed, such that it is checked later
+                    bool call = mTheoryCallScheduler.partialCheck( usedBackends() );
+                    #ifdef SMTRAT_DEVOPTION_Statistics
+                    mpStatistics->partialTheoryCall( !call );
+                    #endif
+                    if( !call )
+                        return;
+                }
                 #ifdef DEBUG_SATMODULE
                 cout << "### Check the constraints: { "; for( auto& subformula : rPassedFormula() ) cout << subformula.formula() << " "; cout << "}" << endl;
                 #endif
                 mChangedPassedFormula = false;
+                if( adaptive )
+                    mTheoryCallScheduler.checkStarted();
                 mCurrentAssignmentConsistent = runBackends( finalCheck, mFullCheck, false );
                 #ifdef DEBUG_SATMODULE
                 cout << "### Result: " << ANSWER_TO_STRING( mCurrentAssignmentConsistent ) << "!" << endl;
@@ -2299,6 +2769,8 @@ namespace smtrat
                         break;
                     }
                 }
+                if( adaptive && mCurrentAssignmentConsistent != ABORTED )
+                    mTheoryCallScheduler.checkFinished( usedBackends(), !finalCheck );
             }
         }
     }
@@ -2384,13 +2856,18 @@ namespace smtrat
                     // Reached bound on number of conflicts:
                     progress_estimate = progressEstimate();
                     cancelUntil( 0 );
+                    if( Settings::inprocessing && conflicts >= mNextInprocessing )
+                        inprocess();
+                    if( mpSharedClauses != nullptr )
+                        importSharedClauses();
                     ++mCurr_Restarts;
                     #ifdef SMTRAT_DEVOPTION_Statistics
                     mpStatistics->restart();
                     #endif
                     return l_Undef;
                 }
-                if( learnts.size() - nAssigns() >= max_learnts && rReceivedFormula().isOnlyPropositional() )
+                // Theory lemmas are only reduced if the learnt clauses are tiered, as otherwise even the useful ones are removed
+                if( learnts.size() - nAssigns() >= max_learnts && (Settings::lbd_tiered_learnts || rReceivedFormula().isOnlyPropositional()) )
                 {
                      // Reduce the set of learned clauses:
                      reduceDB();
@@ -2471,6 +2948,8 @@ namespace smtrat
                 // CONFLICT
                 conflicts++;
                 conflictC++;
+                if( Settings::theory_call_policy == TheoryCallPolicy::ADAPTIVE )
+                    mTheoryCallScheduler.conflict();
 
                 if( decisionLevel() <= assumptions.size() )
                 {
@@ -2507,15 +2986,21 @@ namespace smtrat
         if( value( learnt_clause[0] ) != l_Undef ) Module::storeAssumptionsToCheck( *mpManager );
         #endif
         assert( value( learnt_clause[0] ) == l_Undef );
+        if( mpSharedClauses != nullptr && learnt_clause.size() > 1 && learnt_clause.size() <= (int) Settings::cube_share_size )
+            exportSharedClause( learnt_clause );
         if( learnt_clause.size() == 1 )
         {
             uncheckedEnqueue( learnt_clause[0] );
+            clearOrigins();
         }
         else
         {
             // learnt clause is the asserting clause.
             _confl = ca.alloc( learnt_clause, CONFLICT_CLAUSE );
+            // the asserting literal is already unassigned, but belongs to the conflict level
+            ca[_confl].lbd( computeLBD( learnt_clause ) + 1 );
             learnts.push( _confl );
+            storeLearntOrigins( _confl, analyze_origins );
             attachClause( _confl );
             claBumpActivity( ca[_confl] );
             uncheckedEnqueue( learnt_clause[0], _confl );
@@ -2746,10 +3231,12 @@ namespace smtrat
     template<class Settings>
     bool SATModule<Settings>::analyze( CRef confl, vec<Lit>& out_learnt, int& out_btlevel )
     {
+        SMTRAT_TRACE_SPAN( "sat", "SATModule::analyze" );
 		assert( confl != CRef_Undef );
         int pathC = 0;
         int resolutionSteps = -1;
         Lit p = lit_Undef;
+        clearOrigins();
 
         // Generate conflict clause:
         //
@@ -2760,8 +3247,21 @@ namespace smtrat
         {
             assert( confl != CRef_Undef );    // (otherwise should be UIP)
             Clause& c = ca[confl];
+            if( p != lit_Undef )
+                fixReasonPosition( c );
             if( c.learnt() )
+            {
                 claBumpActivity( c );
+                if( Settings::lbd_tiered_learnts && c.lbd() > Settings::lbd_core_tier )
+                {
+                    // clauses, which take part in conflicts, may be promoted to a better tier
+                    unsigned lbd = computeLBD( c );
+                    if( lbd < c.lbd() )
+                        c.lbd( lbd );
+                    c.used( true );
+                }
+            }
+            collectOrigins( confl );
 
             for( int j = (p == lit_Undef) ? 0 : 1; j < c.size(); j++ )
             {
@@ -2815,12 +3315,16 @@ namespace smtrat
                 else
                 {
                     Clause& c = ca[reason( var( out_learnt[i] ) )];
-                    for( int k = 1; k < c.size(); k++ )
+                    fixReasonPosition( c );
+                    int k;
+                    for( k = 1; k < c.size(); k++ )
                         if( !seen[var( c[k] )] && level( var( c[k] ) ) > 0 )
                         {
                             out_learnt[j++] = out_learnt[i];
                             break;
                         }
+                    if( k == c.size() )
+                        collectOrigins( reason( x ) );
                 }
             }
         }
@@ -2864,7 +3368,10 @@ namespace smtrat
         {
             CRef c_reason = reason(var(analyze_stack.last()));
             assert( c_reason != CRef_Undef );
+            // if p turns out not to be redundant, this over-approximates the origins, which is still sound
+            collectOrigins( c_reason );
             Clause& c = ca[c_reason];
+            fixReasonPosition( c );
             int c_size = c.size();
             analyze_stack.pop();
 
@@ -2893,6 +3400,116 @@ namespace smtrat
         return true;
     }
 
+    template<class Settings>
+    void SATModule<Settings>::collectOrigins( CRef _clause )
+    {
+        if( !Settings::keep_learnts_on_remove || _clause == CRef_Undef )
+            return;
+        if( _clause == CRef_Lazy )
+        {
+            // unexplained theory propagations are not traced, hence depend on everything
+            analyze_origins.push_back( FormulaT( carl::FormulaType::FALSE ) );
+            return;
+        }
+        auto ciIter = mClauseInformation.find( _clause );
+        if( ciIter != mClauseInformation.end() )
+        {
+            analyze_origins.insert( analyze_origins.end(), ciIter->second.mOrigins.begin(), ciIter->second.mOrigins.end() );
+            return;
+        }
+        // theory lemmas are valid and thus neither stored in mClauseInformation nor in mLearntOrigins
+        auto loIter = mLearntOrigins.find( _clause );
+        if( loIter != mLearntOrigins.end() )
+            analyze_origins.insert( analyze_origins.end(), loIter->second.begin(), loIter->second.end() );
+        // literals assigned at decision level 0 are omitted in derived clauses, which hence depend on these assignments
+        const Clause& c = ca[_clause];
+        for( int k = 0; k < c.size(); ++k )
+        {
+            if( level( var( c[k] ) ) == 0 && value( c[k] ) != l_Undef )
+                collectLevelZeroOrigins( c[k] );
+        }
+    }
+
+    template<class Settings>
+    void SATModule<Settings>::collectLevelZeroOrigins( Lit _lit )
+    {
+        if( !Settings::keep_learnts_on_remove || var( _lit ) == mTrueVar || seen[var( _lit )] )
+            return;
+        assert( value( _lit ) != l_Undef && level( var( _lit ) ) == 0 );
+        int head = analyze_levelzero.size();
+        seen[var( _lit )] = 1;
+        analyze_levelzero.push( var( _lit ) );
+        for( ; head < analyze_levelzero.size(); ++head )
+        {
+            Var x = analyze_levelzero[head];
+            // the reasons are not materialised here, as the callers might hold references into the clause allocator
+            CRef r = vardata[x].reason;
+            if( r == CRef_Undef || r == CRef_Lazy )
+            {
+                // unit clauses and unexplained theory propagations are not traced, hence depend on everything
+                analyze_origins.push_back( FormulaT( carl::FormulaType::FALSE ) );
+                continue;
+            }
+            auto ciIter = mClauseInformation.find( r );
+            if( ciIter != mClauseInformation.end() )
+                analyze_origins.insert( analyze_origins.end(), ciIter->second.mOrigins.begin(), ciIter->second.mOrigins.end() );
+            auto loIter = mLearntOrigins.find( r );
+            if( loIter != mLearntOrigins.end() )
+                analyze_origins.insert( analyze_origins.end(), loIter->second.begin(), loIter->second.end() );
+            const Clause& c = ca[r];
+            for( int k = 0; k < c.size(); ++k )
+            {
+                Var y = var( c[k] );
+                if( y != mTrueVar && !seen[y] )
+                {
+                    assert( level( y ) == 0 );
+                    seen[y] = 1;
+                    analyze_levelzero.push( y );
+                }
+            }
+        }
+    }
+
+    template<class Settings>
+    void SATModule<Settings>::clearOrigins()
+    {
+        analyze_origins.clear();
+        for( int i = 0; i < analyze_levelzero.size(); ++i )
+            seen[analyze_levelzero[i]] = 0;
+        analyze_levelzero.clear();
+    }
+
+    template<class Settings>
+    void SATModule<Settings>::storeLearntOrigins( CRef _learnt, std::vector<FormulaT>& _origins )
+    {
+        if( !Settings::keep_learnts_on_remove )
+            return;
+        if( mUpperBoundOnMinimal != passedFormulaEnd() )
+            _origins.push_back( FormulaT( carl::FormulaType::FALSE ) );
+        if( !_origins.empty() )
+        {
+            auto loIter = mLearntOrigins.find( _learnt );
+            if( loIter != mLearntOrigins.end() )
+                _origins.insert( _origins.end(), loIter->second.begin(), loIter->second.end() );
+            std::sort( _origins.begin(), _origins.end() );
+            _origins.erase( std::unique( _origins.begin(), _origins.end() ), _origins.end() );
+            mLearntOrigins[_learnt] = std::move( _origins );
+        }
+        _origins.clear();
+        clearOrigins();
+    }
+
+    template<class Settings>
+    bool SATModule<Settings>::learntDependsOn( CRef _learnt, const FormulaT& _formula ) const
+    {
+        auto loIter = mLearntOrigins.find( _learnt );
+        if( loIter == mLearntOrigins.end() )
+            return false;
+        const std::vector<FormulaT>& origins = loIter->second;
+        return std::binary_search( origins.begin(), origins.end(), _formula )
+            || std::binary_search( origins.begin(), origins.end(), FormulaT( carl::FormulaType::FALSE ) );
+    }
+
     template<class Settings>
     void SATModule<Settings>::uncheckedEnqueue( Lit p, CRef from )
     {
@@ -3032,6 +3649,7 @@ namespace smtrat
     template<class Settings>
     CRef SATModule<Settings>::propagate()
     {
+        SMTRAT_TRACE_SPAN( "sat", "SATModule::propagate" );
         #ifdef DEBUG_SATMODULE
 		cout << "######################################################################" << endl;
         cout << "### Propagate" << endl;
@@ -3050,15 +3668,38 @@ namespace smtrat
         CRef confl = CRef_Undef;
         int num_props = 0;
         watches.cleanAll();
+        watchesBin.cleanAll();
 
         while( qhead < trail.size() )
         {
             Lit p = trail[qhead++];    // 'p' is enqueued fact to propagate.
-            vec<Watcher>& ws = watches[p];
-            Watcher * i, *j, *end;
             num_props++;
 			SMTRAT_LOG_DEBUG("smtrat.sat", "Current literal: " << p);
 
+            // Propagate the binary clauses first, which does not require to access the clauses:
+            const vec<Watcher>& wbin = watchesBin[p];
+            for( int k = 0; k < wbin.size(); k++ )
+            {
+                Lit imp = wbin[k].blocker;
+                if( value( imp ) == l_False )
+                {
+                    confl = wbin[k].cref;
+                    qhead = trail.size();
+                    break;
+                }
+                if( value( imp ) == l_Undef )
+                {
+                    uncheckedEnqueue( imp, wbin[k].cref );
+                    #ifdef SMTRAT_DEVOPTION_Statistics
+                    mpStatistics->propagate();
+                    #endif
+                }
+            }
+            if( confl != CRef_Undef )
+                break;
+
+            vec<Watcher>& ws = watches[p];
+            Watcher * i, *j, *end;
             for( i = j = (Watcher*)ws, end = i + ws.size(); i != end; )
             {
                 // Try to avoid inspecting the clause:
@@ -3142,6 +3783,11 @@ NextClause:
     template<class Settings>
     void SATModule<Settings>::reduceDB()
     {
+        if( Settings::lbd_tiered_learnts )
+        {
+            reduceDBTiered();
+            return;
+        }
         int    i, j;
         double extra_lim = cla_inc / learnts.size();    // Remove any clause below this activity
 
@@ -3159,10 +3805,766 @@ NextClause:
             else
                 learnts[j++] = learnts[i];
         }
+        #ifdef SMTRAT_DEVOPTION_Statistics
+        mpStatistics->reduce( (size_t) (i - j) );
+        #endif
+        learnts.shrink( i - j );
+        checkGarbage();
+    }
+
+    template<class Settings>
+    void SATModule<Settings>::reduceDBTiered()
+    {
+        int i, j;
+        vec<CRef> local;
+        for( i = j = 0; i < learnts.size(); i++ )
+        {
+            Clause& c = ca[learnts[i]];
+            if( c.type() == PERMANENT_CLAUSE || c.size() <= 2 || c.lbd() <= Settings::lbd_core_tier || locked( c ) )
+                learnts[j++] = learnts[i];
+            else if( c.lbd() <= Settings::lbd_tier2 && c.used() )
+            {
+                // keep it until the next reduction, where it is removable if it has not been used again
+                c.used( false );
+                learnts[j++] = learnts[i];
+            }
+            else
+                local.push( learnts[i] );
+        }
         learnts.shrink( i - j );
+        // From the local clauses, delete the half with the lowest activity.
+        sort( local, reduceDB_lt( ca ) );
+        int deleted = local.size() / 2;
+        for( i = 0; i < local.size(); i++ )
+        {
+            if( i < deleted )
+                removeClause( local[i] );
+            else
+            {
+                ca[local[i]].used( false );
+                learnts.push( local[i] );
+            }
+        }
+        #ifdef SMTRAT_DEVOPTION_Statistics
+        mpStatistics->reduce( (size_t) deleted );
+        #endif
         checkGarbage();
     }
 
+    template<class Settings>
+    void SATModule<Settings>::inprocess()
+    {
+        SMTRAT_TRACE_SPAN( "sat", "SATModule::inprocess" );
+        cancelUntil( 0, true );
+        subsumeLearnts();
+        vivifyLearnts();
+        // remove the clauses subsumed or vivified away from the learnt clauses
+        int i, j;
+        for( i = j = 0; i < learnts.size(); i++ )
+        {
+            if( ca[learnts[i]].mark() != 1 )
+                learnts[j++] = learnts[i];
+        }
+        learnts.shrink( i - j );
+        // the backends have not been checked on the assignment at decision level 0
+        mCurrentAssignmentConsistent = UNKNOWN;
+        mNextInprocessing = conflicts + Settings::inprocessing_interval;
+        #ifdef SMTRAT_DEVOPTION_Statistics
+        mpStatistics->inprocess();
+        #endif
+        checkGarbage();
+    }
+
+    template<class Settings>
+    void SATModule<Settings>::subsumeLearnts()
+    {
+        // Build the occurrence lists of the learnt clauses, which can be subsumed or strengthened.
+        vec<vec<CRef>> occs;
+        occs.growTo( 2 * nVars() );
+        for( int i = 0; i < learnts.size(); i++ )
+        {
+            const Clause& c = ca[learnts[i]];
+            if( c.mark() == 1 || c.type() == PERMANENT_CLAUSE )
+                continue;
+            int k = 0;
+            while( k < c.size() && value( c[k] ) == l_Undef ) ++k;
+            if( k < c.size() )
+                continue;
+            for( k = 0; k < c.size(); k++ )
+                occs[toInt( c[k] )].push( learnts[i] );
+        }
+        vec<char> marks;
+        marks.growTo( 2 * nVars(), 0 );
+        uint64_t effort = 0;
+        for( int round = 0; round < 2 && effort < Settings::subsumption_effort; round++ )
+        {
+            // first use the clauses of the received formula, then the learnt clauses for subsumption
+            const vec<CRef>& subsuming = round == 0 ? clauses : learnts;
+            for( int d = 0; d < subsuming.size() && effort < Settings::subsumption_effort; d++ )
+            {
+                CRef dr = subsuming[d];
+                Clause& dc = ca[dr];
+                if( dc.mark() == 1 )
+                    continue;
+                // choose the literal of the subsuming clause with the fewest occurrences
+                Lit best = dc[0];
+                for( int k = 1; k < dc.size(); k++ )
+                {
+                    if( occs[toInt( dc[k] )].size() + occs[toInt( ~dc[k] )].size() < occs[toInt( best )].size() + occs[toInt( ~best )].size() )
+                        best = dc[k];
+                }
+                if( occs[toInt( best )].size() == 0 && occs[toInt( ~best )].size() == 0 )
+                    continue;
+                for( int k = 0; k < dc.size(); k++ )
+                    marks[toInt( dc[k] )] = 1;
+                for( int polarity = 0; polarity < 2; polarity++ )
+                {
+                    const vec<CRef>& candidates = occs[toInt( polarity == 0 ? best : ~best )];
+                    for( int n = 0; n < candidates.size(); n++ )
+                    {
+                        CRef cr = candidates[n];
+                        Clause& c = ca[cr];
+                        if( cr == dr || c.mark() == 1 || c.size() < dc.size() )
+                            continue;
+                        effort += (uint64_t)c.size();
+                        int hits = 0;
+                        Lit negated = lit_Undef;
+                        for( int k = 0; k < c.size(); k++ )
+                        {
+                            if( marks[toInt( c[k] )] )
+                                ++hits;
+                            else if( marks[toInt( ~c[k] )] )
+                            {
+                                if( negated != lit_Undef )
+                                {
+                                    hits = -1;
+                                    break;
+                                }
+                                negated = c[k];
+                            }
+                        }
+                        if( negated == lit_Undef && hits == dc.size() )
+                        {
+                            // the subsuming clause is at least as strong
+                            if( dc.learnt() && c.lbd() < dc.lbd() )
+                                dc.lbd( c.lbd() );
+                            removeClause( cr );
+                            #ifdef SMTRAT_DEVOPTION_Statistics
+                            mpStatistics->subsumed();
+                            #endif
+                        }
+                        else if( negated != lit_Undef && hits == dc.size() - 1 && c.size() > 2 )
+                        {
+                            // self-subsuming resolution removes the negated literal
+                            strengthenClause( cr, negated );
+                            clearOrigins();
+                            collectOrigins( dr );
+                            storeLearntOrigins( cr, analyze_origins );
+                            #ifdef SMTRAT_DEVOPTION_Statistics
+                            mpStatistics->strengthened();
+                            #endif
+                        }
+                    }
+                }
+                for( int k = 0; k < dc.size(); k++ )
+                    marks[toInt( dc[k] )] = 0;
+            }
+        }
+    }
+
+    template<class Settings>
+    void SATModule<Settings>::vivifyLearnts()
+    {
+        vec<CRef> candidates;
+        for( int i = 0; i < learnts.size(); i++ )
+        {
+            const Clause& c = ca[learnts[i]];
+            if( c.mark() == 1 || c.type() == PERMANENT_CLAUSE || c.size() <= 2 || c.lbd() > Settings::lbd_tier2 )
+                continue;
+            int k = 0;
+            while( k < c.size() && value( c[k] ) == l_Undef ) ++k;
+            if( k == c.size() )
+                candidates.push( learnts[i] );
+        }
+        // vivify the most active clauses first
+        sort( candidates, reduceDB_lt( ca ) );
+        unsigned vivified = 0;
+        for( int i = candidates.size() - 1; i >= 0 && vivified < Settings::vivification_candidates; i--, vivified++ )
+        {
+            #ifdef SMTRAT_DEVOPTION_Statistics
+            int removed = vivify( candidates[i] );
+            if( removed > 0 )
+                mpStatistics->vivified( (size_t) removed );
+            #else
+            vivify( candidates[i] );
+            #endif
+        }
+    }
+
+    template<class Settings>
+    int SATModule<Settings>::vivify( CRef _clause )
+    {
+        assert( decisionLevel() == 0 );
+        detachClause( _clause, true );
+        learnt_clause.clear();
+        CRef confl = CRef_Undef;
+        {
+            const Clause& c = ca[_clause];
+            for( int i = 0; i < c.size() && confl == CRef_Undef; i++ )
+            {
+                Lit l = c[i];
+                // literals implied to be false by the negations of the previous literals are not needed
+                if( value( l ) == l_False )
+                    continue;
+                learnt_clause.push( l );
+                // literals implied to be true by the negations of the previous literals make the remaining ones obsolete
+                if( value( l ) == l_True )
+                    break;
+                newDecisionLevel();
+                uncheckedEnqueue( ~l );
+                confl = propagate();
+            }
+        }
+        int removed = ca[_clause].size() - learnt_clause.size();
+        if( removed > 0 && learnt_clause.size() > 1 )
+        {
+            // the vivified clause is implied by the clauses used for propagation
+            clearOrigins();
+            for( int i = trail_lim[0]; i < trail.size(); i++ )
+                collectOrigins( reason( var( trail[i] ) ) );
+            collectOrigins( confl );
+            // the literals false at decision level 0 have been omitted
+            const Clause& c = ca[_clause];
+            for( int i = 0; i < c.size(); i++ )
+            {
+                if( level( var( c[i] ) ) == 0 && value( c[i] ) != l_Undef )
+                    collectLevelZeroOrigins( c[i] );
+            }
+            storeLearntOrigins( _clause, analyze_origins );
+        }
+        else
+            removed = 0;
+        cancelUntil( 0, true );
+        Clause& c = ca[_clause];
+        if( removed > 0 )
+        {
+            for( int i = 0; i < learnt_clause.size(); i++ )
+                c[i] = learnt_clause[i];
+            c.shrink( removed );
+            if( c.lbd() > (unsigned) c.size() )
+                c.lbd( (unsigned) c.size() );
+        }
+        attachClause( _clause );
+        return removed;
+    }
+
+    template<class Settings>
+    void SATModule<Settings>::strengthenClause( CRef _clause, Lit _lit )
+    {
+        detachClause( _clause, true );
+        Clause& c = ca[_clause];
+        int i = 0;
+        while( c[i] != _lit ) ++i;
+        c[i] = c.last();
+        c.shrink( 1 );
+        if( c.lbd() > (unsigned) c.size() )
+            c.lbd( (unsigned) c.size() );
+        attachClause( _clause );
+    }
+
+    template<class Settings>
+    void SATModule<Settings>::preprocess()
+    {
+        SMTRAT_TRACE_SPAN( "sat", "SATModule::preprocess" );
+        assert( ok && mEliminatedClauses.empty() && mResolvents.empty() && mEliminatedVars.empty() );
+        cancelUntil( 0, true );
+        mPreprocessed = true;
+        mPreprocessedClauses = clauses.size();
+        mPreprocessedVars.clear();
+        mPreprocessedVars.growTo( nVars(), 0 );
+        preprocess_effort = (int64_t) Settings::preprocessing_effort;
+        // Only the Tseitin variables of the received formula may be eliminated, which excludes the abstractions of
+        // constraints, Boolean variables, the Tseitin variables of lemmas and the variables of assumptions.
+        preprocess_frozen.clear();
+        preprocess_frozen.growTo( nVars(), 1 );
+        for( const auto& cnfInfo : mFormulaCNFInfosMap )
+        {
+            if( cnfInfo.second.mLiteral != lit_Undef && mBooleanConstraintMap[var( cnfInfo.second.mLiteral )].first == nullptr )
+                preprocess_frozen[var( cnfInfo.second.mLiteral )] = 0;
+        }
+        for( int i = 0; i < assumptions.size(); ++i )
+            preprocess_frozen[var( assumptions[i] )] = 1;
+        preprocess_frozen[mTrueVar] = 1;
+        if( probeFailedLiterals() )
+        {
+            // Build the occurrence lists of the problem clauses whose literals are all unassigned. The variables of the
+            // remaining problem clauses must not be eliminated, as these clauses are not considered.
+            preprocess_occs.clear();
+            preprocess_occs.growTo( 2 * nVars() );
+            preprocess_marks.clear();
+            preprocess_marks.growTo( 2 * nVars(), 0 );
+            for( int i = 0; i < clauses.size(); ++i )
+            {
+                const Clause& c = ca[clauses[i]];
+                bool unassigned = true;
+                for( int k = 0; k < c.size() && unassigned; ++k )
+                    unassigned = value( c[k] ) == l_Undef;
+                for( int k = 0; k < c.size(); ++k )
+                {
+                    if( unassigned )
+                        preprocess_occs[toInt( c[k] )].push( clauses[i] );
+                    else
+                        preprocess_frozen[var( c[k] )] = 1;
+                }
+            }
+            for( Var v = 0; v < nVars(); ++v )
+            {
+                if( value( v ) != l_Undef )
+                    preprocess_frozen[v] = 1;
+            }
+            if( substituteEquivalentLiterals() )
+            {
+                eliminateVariables();
+                eliminateBlockedClauses();
+            }
+        }
+        if( !ok )
+            updateInfeasibleSubset();
+        // the clauses introduced and eliminated again have been freed
+        size_t j = 0;
+        for( size_t i = 0; i < mResolvents.size(); ++i )
+        {
+            if( preprocess_removed.find( mResolvents[i] ) == preprocess_removed.end() )
+                mResolvents[j++] = mResolvents[i];
+        }
+        mResolvents.resize( j );
+        preprocess_occs.clear( true );
+        preprocess_removed.clear();
+        // the backends have not been checked on the assignment at decision level 0
+        mCurrentAssignmentConsistent = UNKNOWN;
+        #ifdef SMTRAT_DEVOPTION_Statistics
+        mpStatistics->preprocess();
+        #endif
+        checkGarbage();
+    }
+
+    template<class Settings>
+    void SATModule<Settings>::restorePreprocessing( bool _removeUnits )
+    {
+        SMTRAT_TRACE_SPAN( "sat", "SATModule::restorePreprocessing" );
+        cancelUntil( 0, true );
+        for( CRef cr : mResolvents )
+        {
+            if( Settings::keep_learnts_on_remove )
+                mLearntOrigins.erase( cr );
+            removeClause( cr );
+        }
+        mResolvents.clear();
+        for( CRef cr : mEliminatedClauses )
+            attachClause( cr );
+        mEliminatedClauses.clear();
+        for( const auto& varDecision : mEliminatedVars )
+            setDecisionVar( varDecision.first, varDecision.second );
+        mEliminatedVars.clear();
+        mPreprocessedVars.clear();
+        if( _removeUnits && mPreprocessingTrail >= 0 )
+        {
+            for( int i = 0; i < learnts.size(); ++i )
+                removeClause( learnts[i] );
+            learnts.clear();
+            for( int c = trail.size() - 1; c >= mPreprocessingTrail; --c )
+            {
+                Var x = var( trail[c] );
+                resetVariableAssignment( x );
+                VarData& vd = vardata[x];
+                if( vd.mExpPos > 0 )
+                {
+                    removeTheoryPropagation( vd.mExpPos );
+                    vd.mExpPos = -1;
+                }
+                vd.reason = CRef_Undef;
+                vd.mTrailIndex = -1;
+                insertVarOrder( x );
+            }
+            trail.shrink( trail.size() - mPreprocessingTrail );
+            mPreprocessingTrail = -1;
+        }
+        // the attached clauses might be unit or conflicting under the assignment at decision level zero
+        qhead = 0;
+        mPreprocessed = false;
+    }
+
+    template<class Settings>
+    bool SATModule<Settings>::touchesPreprocessing( int _firstClause ) const
+    {
+        for( int i = _firstClause; i < clauses.size(); ++i )
+        {
+            const Clause& c = ca[clauses[i]];
+            for( int k = 0; k < c.size(); ++k )
+            {
+                if( var( c[k] ) < mPreprocessedVars.size() && mPreprocessedVars[var( c[k] )] )
+                    return true;
+            }
+        }
+        return false;
+    }
+
+    template<class Settings>
+    bool SATModule<Settings>::probeFailedLiterals()
+    {
+        for( Var v = 0; v < nVars() && preprocess_effort > 0; ++v )
+        {
+            if( preprocess_frozen[v] )
+                continue;
+            for( int s = 0; s < 2 && value( v ) == l_Undef; ++s )
+            {
+                Lit l = mkLit( v, s == 1 );
+                uint64_t propagationsBefore = propagations;
+                newDecisionLevel();
+                uncheckedEnqueue( l );
+                CRef confl = propagate();
+                cancelUntil( 0, true );
+                preprocess_effort -= (int64_t) (propagations - propagationsBefore);
+                if( confl == CRef_Undef )
+                    continue;
+                // the negation of the literal is implied by the clauses
+                if( mPreprocessingTrail < 0 )
+                    mPreprocessingTrail = trail.size();
+                uncheckedEnqueue( ~l );
+                #ifdef SMTRAT_DEVOPTION_Statistics
+                mpStatistics->failedLiteral();
+                #endif
+                if( propagate() != CRef_Undef )
+                    return ok = false;
+            }
+        }
+        return true;
+    }
+
+    template<class Settings>
+    bool SATModule<Settings>::substituteEquivalentLiterals()
+    {
+        // Compute the strongly connected components of the implication graph of the binary clauses by Tarjan's algorithm.
+        int nodes = 2 * nVars();
+        std::vector<int> index( (size_t) nodes, -1 );
+        std::vector<int> lowlink( (size_t) nodes, 0 );
+        std::vector<int> component( (size_t) nodes, -1 );
+        std::vector<char> onStack( (size_t) nodes, 0 );
+        std::vector<int> sccStack;
+        std::vector<std::pair<int,int>> callStack;
+        int counter = 0;
+        int components = 0;
+        for( int root = 0; root < nodes; ++root )
+        {
+            if( index[(size_t) root] >= 0 || value( toLit( root ) ) != l_Undef )
+                continue;
+            index[(size_t) root] = lowlink[(size_t) root] = counter++;
+            sccStack.push_back( root );
+            onStack[(size_t) root] = 1;
+            callStack.emplace_back( root, 0 );
+            while( !callStack.empty() )
+            {
+                int u = callStack.back().first;
+                // the successors of a literal are the other literals of the binary clauses containing its negation
+                const vec<CRef>& os = preprocess_occs[toInt( ~toLit( u ) )];
+                bool descended = false;
+                while( callStack.back().second < os.size() )
+                {
+                    CRef cr = os[callStack.back().second++];
+                    const Clause& c = ca[cr];
+                    if( c.size() != 2 || preprocess_removed.find( cr ) != preprocess_removed.end() )
+                        continue;
+                    int w = toInt( c[0] == ~toLit( u ) ? c[1] : c[0] );
+                    if( index[(size_t) w] < 0 )
+                    {
+                        index[(size_t) w] = lowlink[(size_t) w] = counter++;
+                        sccStack.push_back( w );
+                        onStack[(size_t) w] = 1;
+                        callStack.emplace_back( w, 0 );
+                        descended = true;
+                        break;
+                    }
+                    else if( onStack[(size_t) w] )
+                        lowlink[(size_t) u] = std::min( lowlink[(size_t) u], index[(size_t) w] );
+                }
+                if( descended )
+                    continue;
+                if( lowlink[(size_t) u] == index[(size_t) u] )
+                {
+                    int w;
+                    do
+                    {
+                        w = sccStack.back();
+                        sccStack.pop_back();
+                        onStack[(size_t) w] = 0;
+                        component[(size_t) w] = components;
+                    }
+                    while( w != u );
+                    ++components;
+                }
+                callStack.pop_back();
+                if( !callStack.empty() )
+                {
+                    int parent = callStack.back().first;
+                    lowlink[(size_t) parent] = std::min( lowlink[(size_t) parent], lowlink[(size_t) u] );
+                }
+            }
+        }
+        // The representative of a component is preferably a literal which must not be eliminated and otherwise the
+        // literal with the smallest variable. As the choice only depends on the variables, the representatives of
+        // complementary components are complementary.
+        std::vector<Lit> representative( (size_t) components, lit_Undef );
+        for( int node = 0; node < nodes; ++node )
+        {
+            if( component[(size_t) node] < 0 )
+                continue;
+            if( component[(size_t) node] == component[(size_t) toInt( ~toLit( node ) )] )
+                return ok = false;
+            Lit& rep = representative[(size_t) component[(size_t) node]];
+            if( rep == lit_Undef || (preprocess_frozen[var( toLit( node ) )] && !preprocess_frozen[var( rep )]) )
+                rep = toLit( node );
+        }
+        vec<Lit> substituted;
+        vec<vec<Lit>> newClauses;
+        for( Var x = 0; x < nVars() && preprocess_effort > 0; ++x )
+        {
+            if( preprocess_frozen[x] || component[(size_t) toInt( mkLit( x ) )] < 0 )
+                continue;
+            Lit rep = representative[(size_t) component[(size_t) toInt( mkLit( x ) )]];
+            if( var( rep ) == x )
+                continue;
+            // replace x by its representative, such that the binary clauses of the equivalence become tautologies
+            vec<CRef> occs;
+            occurrences( mkLit( x, false ) ).copyTo( occs );
+            const vec<CRef>& negOccs = occurrences( mkLit( x, true ) );
+            for( int i = 0; i < negOccs.size(); ++i )
+                occs.push( negOccs[i] );
+            newClauses.clear();
+            bool unit = false;
+            for( int i = 0; i < occs.size() && !unit; ++i )
+            {
+                const Clause& c = ca[occs[i]];
+                preprocess_effort -= c.size();
+                substituted.clear();
+                bool tautology = false;
+                for( int k = 0; k < c.size() && !tautology; ++k )
+                {
+                    Lit l = var( c[k] ) == x ? (sign( c[k] ) ? ~rep : rep) : c[k];
+                    if( preprocess_marks[toInt( ~l )] )
+                        tautology = true;
+                    else if( !preprocess_marks[toInt( l )] )
+                    {
+                        preprocess_marks[toInt( l )] = 1;
+                        substituted.push( l );
+                    }
+                }
+                for( int k = 0; k < substituted.size(); ++k )
+                    preprocess_marks[toInt( substituted[k] )] = 0;
+                if( tautology )
+                    continue;
+                unit = substituted.size() < 2;
+                newClauses.push();
+                substituted.copyTo( newClauses.last() );
+            }
+            // units would have to be assigned, which is left to the search
+            if( unit )
+                continue;
+            for( int i = 0; i < occs.size(); ++i )
+                eliminateClause( occs[i] );
+            for( int i = 0; i < newClauses.size(); ++i )
+                addPreprocessingClause( newClauses[i] );
+            mEliminatedVars.emplace_back( x, (bool) decision[x] );
+            mPreprocessedVars[x] = 1;
+            setDecisionVar( x, false );
+            preprocess_frozen[x] = 1;
+            #ifdef SMTRAT_DEVOPTION_Statistics
+            mpStatistics->substitutedVariable();
+            #endif
+        }
+        return true;
+    }
+
+    template<class Settings>
+    void SATModule<Settings>::eliminateVariables()
+    {
+        // try the variables with the fewest possible resolvents first
+        std::vector<std::pair<int,Var>> candidates;
+        for( Var x = 0; x < nVars(); ++x )
+        {
+            if( !preprocess_frozen[x] )
+                candidates.emplace_back( occurrences( mkLit( x, false ) ).size() * occurrences( mkLit( x, true ) ).size(), x );
+        }
+        std::sort( candidates.begin(), candidates.end() );
+        vec<Lit> resolvent;
+        vec<vec<Lit>> resolvents;
+        for( const auto& candidate : candidates )
+        {
+            if( preprocess_effort <= 0 )
+                break;
+            Var x = candidate.second;
+            vec<CRef> pos, neg;
+            occurrences( mkLit( x, false ) ).copyTo( pos );
+            occurrences( mkLit( x, true ) ).copyTo( neg );
+            if( (unsigned) (pos.size() + neg.size()) > Settings::elimination_occurrence_limit )
+                continue;
+            // the elimination must neither increase the number of clauses nor introduce units
+            resolvents.clear();
+            bool eliminable = true;
+            for( int i = 0; i < pos.size() && eliminable; ++i )
+            {
+                const Clause& p = ca[pos[i]];
+                for( int k = 0; k < p.size(); ++k )
+                    preprocess_marks[toInt( p[k] )] = 1;
+                for( int j = 0; j < neg.size() && eliminable; ++j )
+                {
+                    const Clause& n = ca[neg[j]];
+                    preprocess_effort -= p.size() + n.size();
+                    resolvent.clear();
+                    for( int k = 0; k < p.size(); ++k )
+                    {
+                        if( var( p[k] ) != x )
+                            resolvent.push( p[k] );
+                    }
+                    bool tautology = false;
+                    for( int k = 0; k < n.size() && !tautology; ++k )
+                    {
+                        if( var( n[k] ) == x || preprocess_marks[toInt( n[k] )] )
+                            continue;
+                        if( preprocess_marks[toInt( ~n[k] )] )
+                            tautology = true;
+                        else
+                            resolvent.push( n[k] );
+                    }
+                    if( tautology )
+                        continue;
+                    if( resolvent.size() < 2 || (unsigned) resolvent.size() > Settings::elimination_resolvent_limit || resolvents.size() >= pos.size() + neg.size() )
+                        eliminable = false;
+                    else
+                    {
+                        resolvents.push();
+                        resolvent.copyTo( resolvents.last() );
+                    }
+                }
+                for( int k = 0; k < p.size(); ++k )
+                    preprocess_marks[toInt( p[k] )] = 0;
+            }
+            if( !eliminable )
+                continue;
+            for( int i = 0; i < pos.size(); ++i )
+                eliminateClause( pos[i] );
+            for( int i = 0; i < neg.size(); ++i )
+                eliminateClause( neg[i] );
+            for( int i = 0; i < resolvents.size(); ++i )
+                addPreprocessingClause( resolvents[i] );
+            mEliminatedVars.emplace_back( x, (bool) decision[x] );
+            mPreprocessedVars[x] = 1;
+            setDecisionVar( x, false );
+            preprocess_frozen[x] = 1;
+            #ifdef SMTRAT_DEVOPTION_Statistics
+            mpStatistics->eliminatedVariable();
+            #endif
+        }
+    }
+
+    template<class Settings>
+    void SATModule<Settings>::eliminateBlockedClauses()
+    {
+        std::vector<CRef> candidates( mResolvents );
+        for( int i = 0; i < clauses.size(); ++i )
+            candidates.push_back( clauses[i] );
+        for( CRef cr : candidates )
+        {
+            if( preprocess_effort <= 0 )
+                break;
+            if( preprocess_removed.find( cr ) != preprocess_removed.end() )
+                continue;
+            const Clause& c = ca[cr];
+            bool unassigned = true;
+            for( int k = 0; k < c.size() && unassigned; ++k )
+                unassigned = value( c[k] ) == l_Undef;
+            if( !unassigned )
+                continue;
+            for( int k = 0; k < c.size(); ++k )
+                preprocess_marks[toInt( c[k] )] = 1;
+            Var blockingVar = var_Undef;
+            for( int k = 0; k < c.size() && blockingVar == var_Undef; ++k )
+            {
+                if( preprocess_frozen[var( c[k] )] )
+                    continue;
+                // the clause is blocked on c[k], if it resolves to a tautology with each clause containing its negation
+                bool blocked = true;
+                const vec<CRef>& occs = occurrences( ~c[k] );
+                for( int i = 0; i < occs.size() && blocked; ++i )
+                {
+                    const Clause& d = ca[occs[i]];
+                    preprocess_effort -= d.size();
+                    blocked = false;
+                    for( int l = 0; l < d.size() && !blocked; ++l )
+                        blocked = d[l] != ~c[k] && preprocess_marks[toInt( ~d[l] )];
+                }
+                if( blocked )
+                    blockingVar = var( c[k] );
+            }
+            for( int k = 0; k < c.size(); ++k )
+                preprocess_marks[toInt( c[k] )] = 0;
+            if( blockingVar != var_Undef )
+            {
+                // a new clause containing this variable might not resolve to a tautology with the eliminated clause
+                mPreprocessedVars[blockingVar] = 1;
+                eliminateClause( cr );
+                #ifdef SMTRAT_DEVOPTION_Statistics
+                mpStatistics->blockedClause();
+                #endif
+            }
+        }
+    }
+
+    template<class Settings>
+    void SATModule<Settings>::eliminateClause( CRef _clause )
+    {
+        assert( preprocess_removed.find( _clause ) == preprocess_removed.end() );
+        preprocess_removed.insert( _clause );
+        if( mClauseInformation.find( _clause ) != mClauseInformation.end() )
+        {
+            // problem clauses stay in clauses, such that their positions stored in mClauseInformation remain valid
+            detachClause( _clause, true );
+            mEliminatedClauses.push_back( _clause );
+        }
+        else
+        {
+            if( Settings::keep_learnts_on_remove )
+                mLearntOrigins.erase( _clause );
+            removeClause( _clause );
+        }
+    }
+
+    template<class Settings>
+    void SATModule<Settings>::addPreprocessingClause( const vec<Lit>& _clause )
+    {
+        assert( _clause.size() > 1 );
+        CRef cr = ca.alloc( _clause, NORMAL_CLAUSE );
+        mResolvents.push_back( cr );
+        if( Settings::keep_learnts_on_remove )
+            mLearntOrigins[cr] = std::vector<FormulaT>( { FormulaT( carl::FormulaType::FALSE ) } );
+        attachClause( cr );
+        for( int k = 0; k < _clause.size(); ++k )
+            preprocess_occs[toInt( _clause[k] )].push( cr );
+    }
+
+    template<class Settings>
+    vec<CRef>& SATModule<Settings>::occurrences( Lit _lit )
+    {
+        vec<CRef>& occs = preprocess_occs[toInt( _lit )];
+        int i, j;
+        for( i = j = 0; i < occs.size(); ++i )
+        {
+            if( preprocess_removed.find( occs[i] ) == preprocess_removed.end() )
+                occs[j++] = occs[i];
+        }
+        occs.shrink( i - j );
+        return occs;
+    }
+
     template<class Settings>
     void SATModule<Settings>::clearLearnts( int n )
     {
@@ -3239,6 +4641,8 @@ NextClause:
         {
             // Learn the lemmas.
             (*backend)->updateLemmas();
+            if( Settings::theory_call_policy == TheoryCallPolicy::ADAPTIVE && !(*backend)->lemmas().empty() )
+                mTheoryCallScheduler.lemmasProvided( **backend );
             if( !(mCurrentAssignmentConsistent == SAT && fullAssignment()) )
             {
                 for( const auto& lem : (*backend)->lemmas() )
@@ -3404,6 +4808,30 @@ NextClause:
         }
         mClauseInformation = std::move( tmp );
 
+        carl::FastMap<Minisat::CRef,std::vector<FormulaT>> tmpLearntOrigins;
+        for( auto& loPair : mLearntOrigins )
+        {
+            CRef c = loPair.first;
+            ca.reloc( c, to );
+            tmpLearntOrigins.emplace( c, std::move( loPair.second ) );
+        }
+        mLearntOrigins = std::move( tmpLearntOrigins );
+
+        carl::FastMap<Minisat::CRef,typename ExplanationCache::iterator> tmpExplanationClauses;
+        for( auto& ecPair : mExplanationClauses )
+        {
+            CRef c = ecPair.first;
+            ca.reloc( c, to );
+            ecPair.second->second.mClause = c;
+            tmpExplanationClauses.emplace( c, ecPair.second );
+        }
+        mExplanationClauses = std::move( tmpExplanationClauses );
+
+        for( CRef& c : mEliminatedClauses )
+            ca.reloc( c, to );
+        for( CRef& c : mResolvents )
+            ca.reloc( c, to );
+
         if( Settings::check_if_all_clauses_are_satisfied )
         {
             for( auto& lcsPair : mLiteralClausesMap )
@@ -3431,6 +4859,7 @@ NextClause:
         //
         // for (int i = 0; i < watches.size(); i++)
         watches.cleanAll();
+        watchesBin.cleanAll();
         for( int v = 0; v < nVars(); v++ )
             for( int s = 0; s < 2; s++ )
             {
@@ -3439,6 +4868,9 @@ NextClause:
                 vec<Watcher>& ws = watches[p];
                 for( int j = 0; j < ws.size(); j++ )
                     ca.reloc( ws[j].cref, to );
+                vec<Watcher>& wbin = watchesBin[p];
+                for( int j = 0; j < wbin.size(); j++ )
+                    ca.reloc( wbin[j].cref, to );
             }
 
         // All reasons:
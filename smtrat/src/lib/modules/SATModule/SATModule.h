@@ -35,7 +35,14 @@
 #include "Options.h"
 #include "SolverTypes.h"
 #include "Sort.h"
+#include "TheoryCallScheduler.h"
 #include <math.h>
+#include <list>
+#include <atomic>
+#include <mutex>
+#ifdef SMTRAT_STRAT_PARALLEL_MODE
+#include <thread>
+#endif
 #include "../../solver/Module.h"
 #include "../../solver/RuntimeSettings.h"
 
@@ -319,6 +326,27 @@ namespace smtrat
             /// A set of vectors of integer representing a set of clauses.
             typedef std::set<std::vector<int>> ClauseSet;
             
+            /// The keys of the explanation cache, ordered from the most to the least recently used one.
+            typedef std::list<const std::vector<int>*> ExplanationLru;
+            
+            /// The clause explaining a theory propagation, if it still exists, how often the propagation has been explained and its position in the LRU order.
+            struct ExplanationInfo
+            {
+                Minisat::CRef mClause = Minisat::CRef_Undef;
+                size_t mDerivations = 0;
+                ExplanationLru::iterator mLruPos;
+            };
+            
+            /// Maps the sorted literals of the clauses explaining theory propagations to their explanation.
+            typedef std::map<std::vector<int>,ExplanationInfo> ExplanationCache;
+            
+            /// The learnt clauses shared between the workers of the cube and conquer mode, each with the index of its worker.
+            struct SharedClauses
+            {
+                std::mutex mMutex;
+                std::vector<std::pair<size_t,FormulaT>> mClauses;
+            };
+            
             ///
             typedef carl::FastMap<signed,std::vector<signed>> TseitinVarShadows;
             
@@ -459,8 +487,13 @@ namespace smtrat
             Minisat::vec<double> activity;
             /// Amount to bump next variable with.
             double var_inc;
-            /// 'watches[lit]' is a list of constraints watching 'lit' (will go there if literal becomes true).
+            /// 'watches[lit]' is a list of constraints with more than two literals watching 'lit' (will go there if literal becomes true).
             Minisat::OccLists<Minisat::Lit, Minisat::vec<Watcher>, WatcherDeleted> watches;
+            /**
+             * 'watchesBin[lit]' is the list of binary clauses containing the negation of 'lit'. The blocker of each watcher
+             * is the other literal of the clause, which is implied if 'lit' becomes true.
+             */
+            Minisat::OccLists<Minisat::Lit, Minisat::vec<Watcher>, WatcherDeleted> watchesBin;
             /// The current assignments.
             Minisat::vec<Minisat::lbool> assigns;
             /// The preferred polarity of each variable.
@@ -497,8 +530,28 @@ namespace smtrat
             Minisat::vec<Minisat::Lit> analyze_stack;
             /// [Minisat related code]
             Minisat::vec<Minisat::Lit> analyze_toclear;
+            /// The received formulas the clause learnt by analyze depends on.
+            std::vector<FormulaT> analyze_origins;
+            /// The variables assigned at decision level 0 whose derivation has been added to analyze_origins (marked in seen).
+            Minisat::vec<Minisat::Var> analyze_levelzero;
             /// [Minisat related code]
             Minisat::vec<Minisat::Lit> add_tmp;
+            /// Stores for each decision level the stamp of the last LBD computation it occurred in.
+            Minisat::vec<uint64_t> lbd_levels;
+            /// The stamp of the current LBD computation.
+            uint64_t lbd_stamp;
+            /// The number of conflicts after which the next inprocessing pass is performed.
+            uint64_t mNextInprocessing;
+            /// Stores for each variable whether it must not be eliminated by the current preprocessing pass.
+            Minisat::vec<char> preprocess_frozen;
+            /// The occurrence lists of the clauses considered by the current preprocessing pass, indexed by literals.
+            Minisat::vec<Minisat::vec<Minisat::CRef>> preprocess_occs;
+            /// The clauses eliminated by the current preprocessing pass, which may still occur in the occurrence lists.
+            carl::FastSet<Minisat::CRef> preprocess_removed;
+            /// Marks the literals of the clause currently resolved or checked for being blocked.
+            Minisat::vec<char> preprocess_marks;
+            /// The remaining number of propagations and literal visits of the current preprocessing pass.
+            int64_t preprocess_effort;
             /// [Minisat related code]
             double max_learnts;
             /// [Minisat related code]
@@ -538,6 +591,40 @@ namespace smtrat
             Answer mCurrentAssignmentConsistent;
             /// The number of full laze calls made.
             size_t mNumberOfFullLazyCalls;
+            /// Decides on which partial assignments the backends are called, if the adaptive theory call policy is used.
+            TheoryCallScheduler mTheoryCallScheduler;
+            /// The learnt clauses shared between the workers, if the cube and conquer mode is used.
+            SharedClauses mSharedClauses;
+            /// The workers solving the cubes, if the cube and conquer mode is used.
+            std::vector<SATModule<Settings>*> mCubeWorkers;
+            /// Terminates the checks of the workers, as soon as the received formula has been decided.
+            std::atomic<bool> mCubeDecided;
+            /// The learnt clauses shared with the other workers, if this SATModule is a worker, otherwise nullptr.
+            SharedClauses* mpSharedClauses;
+            /// The index of this SATModule among the workers.
+            size_t mWorkerId;
+            /// The number of shared clauses this worker has already imported.
+            size_t mImportedSharedClauses;
+            /// The number of assumptions made before the literals of the current cube have been assumed, or -1 if there is no such cube.
+            int mAssumptionsBeforeCube;
+            /// True, if the last check has been decided by a worker, whose model has been stored in mCubeModel.
+            bool mSolvedByCube;
+            /// The model found by the worker which has decided the last check.
+            Model mCubeModel;
+            /// True, if the clauses have been preprocessed and no formula has been added or removed since then.
+            bool mPreprocessed;
+            /// The position in the trail of the first literal found by failed literal probing, or -1 if there is none.
+            int mPreprocessingTrail;
+            /// The problem clauses eliminated by the preprocessing, which are detached but still stored in clauses.
+            std::vector<Minisat::CRef> mEliminatedClauses;
+            /// The clauses introduced by the preprocessing, i.e., resolvents and clauses with substituted literals.
+            std::vector<Minisat::CRef> mResolvents;
+            /// The variables eliminated or substituted by the preprocessing together with their former eligibility for decisions.
+            std::vector<std::pair<Minisat::Var,bool>> mEliminatedVars;
+            /// Stores for each variable whether the preprocessing relies on its occurrences, i.e., it has been eliminated or substituted or a clause has been blocked on it.
+            Minisat::vec<char> mPreprocessedVars;
+            /// The number of problem clauses when the clauses have been preprocessed the last time.
+            int mPreprocessedClauses;
             /// The number of restarts made.
             int mCurr_Restarts;
             /// The number of theory calls made.
@@ -566,6 +653,19 @@ namespace smtrat
             ClauseSet mLearntDeductions;
             ///
             carl::FastMap<Minisat::CRef,ClauseInformation> mClauseInformation;
+            /**
+             * Maps learnt clauses to the sorted received formulas they have been derived from. Learnt clauses without an
+             * entry do not depend on any received formula. A learnt clause containing the formula false depends on the
+             * current upper bound on the objective or on a clause introduced by the preprocessing and is removed whenever
+             * a received formula is removed. The clauses introduced by the preprocessing are mapped to the formula false.
+             */
+            carl::FastMap<Minisat::CRef,std::vector<FormulaT>> mLearntOrigins;
+            /// Caches the explanations of theory propagations. The cache is kept across restarts.
+            ExplanationCache mExplanationCache;
+            /// The order in which the entries of the explanation cache have been used.
+            ExplanationLru mExplanationLru;
+            /// Maps the clauses explaining theory propagations to their entry in the explanation cache.
+            carl::FastMap<Minisat::CRef,typename ExplanationCache::iterator> mExplanationClauses;
             ///
             std::unordered_map<int,std::unordered_set<Minisat::CRef>> mLiteralClausesMap;
             ///
@@ -610,6 +710,8 @@ namespace smtrat
             Minisat::vec<Minisat::vec<Minisat::Lit>> mLemmas;
             /// is the lemma removable
             Minisat::vec<bool> mLemmasRemovable;
+            /// does the lemma depend on all received formulas, as literals assigned at decision level 0 have been omitted or it has been imported from another worker
+            Minisat::vec<bool> mLemmasDependOnAll;
             /*
              * MC-SAT related members.
              */
@@ -1165,6 +1267,38 @@ namespace smtrat
              */
             bool litRedundant( Minisat::Lit p, uint32_t abstract_levels );
             
+            /**
+             * Adds the received formulas the given clause has been derived from to analyze_origins.
+             * @param _clause A clause used to derive the clause learnt by analyze.
+             */
+            void collectOrigins( Minisat::CRef _clause );
+            
+            /**
+             * Adds the received formulas the assignment of the given literal at decision level 0 has been derived from to
+             * analyze_origins. Assignments without a reason clause are assumed to depend on every received formula.
+             * @param _lit A literal assigned at decision level 0.
+             */
+            void collectLevelZeroOrigins( Minisat::Lit _lit );
+            
+            /**
+             * Clears analyze_origins and the marks set by collectLevelZeroOrigins.
+             */
+            void clearOrigins();
+            
+            /**
+             * Stores the received formulas the given learnt clause has been derived from, in addition to those already stored for it.
+             * @param _learnt The learnt clause.
+             * @param _origins The received formulas the learnt clause depends on. This vector is consumed.
+             */
+            void storeLearntOrigins( Minisat::CRef _learnt, std::vector<FormulaT>& _origins );
+            
+            /**
+             * @param _learnt A learnt clause.
+             * @param _formula A received formula.
+             * @return true, if the given learnt clause depends on the given received formula.
+             */
+            bool learntDependsOn( Minisat::CRef _learnt, const FormulaT& _formula ) const;
+            
             /**
              * Adds clauses representing the lemmas which should be added to this SATModule. This may provoke backtracking.
              * @return true, if any clause has been added.
@@ -1186,6 +1320,76 @@ namespace smtrat
              */
             Minisat::CRef propagateConsistently( bool _checkWithTheory = true );
             void propagateTheory();
+            
+            /**
+             * Reuses the given clause as reason for the given literal, if it is asserting, i.e., it contains the literal and
+             * all its other literals are false and have been assigned before it. The literals of the clause are reordered
+             * accordingly.
+             * @param _clause The clause explaining a theory propagation.
+             * @param _lit The propagated literal.
+             * @return true, if the clause can be used as reason for the given literal.
+             */
+            bool reuseExplanation( Minisat::CRef _clause, Minisat::Lit _lit );
+            
+            /**
+             * Looks up the entry of the clause consisting of the given literals in the explanation cache and marks it as
+             * the most recently used one. A missing entry is created, if the cache is full the least recently used entry is
+             * forgotten before.
+             * @param _lits The literals of a clause explaining a theory propagation.
+             * @return The entry in the explanation cache.
+             */
+            typename ExplanationCache::iterator explanationCacheEntry( const Minisat::vec<Minisat::Lit>& _lits );
+            
+            /**
+             * Stores the given clause as explanation of the given theory propagation. If the propagation has been explained
+             * before, the clause is protected from being removed by the reduction of the learnt clauses, which only applies
+             * if lbd_tiered_learnts is enabled.
+             * @param _entry The entry of the theory propagation in the explanation cache.
+             * @param _clause The clause explaining the theory propagation.
+             */
+            void cacheExplanation( typename ExplanationCache::iterator _entry, Minisat::CRef _clause );
+            
+            /**
+             * Splits the search into cubes over the most active decision variables and solves them by worker SATModules,
+             * which are created by the manager on the first call.
+             * @return l_True, if the received formula is satisfiable under a cube;
+             *         l_False, if it is unsatisfiable under all cubes;
+             *         l_Undef, otherwise.
+             */
+            Minisat::lbool cubeAndConquer();
+            
+            /**
+             * Checks the received formula of this worker under the given cube. The resulting assignment is kept until
+             * endCube is called.
+             * @param _cube The literals to assume.
+             * @param _full false, if the backends should avoid too expensive procedures and rather return unknown instead.
+             * @return The result of the search under the given cube.
+             */
+            Minisat::lbool checkCube( const FormulasT& _cube, bool _full );
+            
+            /**
+             * Takes back the assumption of the last cube checked by this worker.
+             */
+            void endCube();
+            
+            /**
+             * Offers the given learnt clause to the other workers, if all of its literals are abstractions of received
+             * Boolean variables or constraints.
+             * @param _clause The learnt clause.
+             */
+            void exportSharedClause( const Minisat::vec<Minisat::Lit>& _clause );
+            
+            /**
+             * Adds the clauses shared by the other workers since the last import as lemmas. As their derivation is not
+             * traced, they depend on all received formulas and are removed as soon as a formula is removed.
+             */
+            void importSharedClauses();
+            
+            /**
+             * @param _formula A literal.
+             * @return The Minisat literal of the given formula, or lit_Undef, if the formula has not been abstracted.
+             */
+            Minisat::Lit findLiteral( const FormulaT& _formula ) const;
             void theoryCall();
             void constructLemmas();
             bool expPositionsCorrect() const;
@@ -1235,6 +1439,142 @@ namespace smtrat
              */
             void reduceDB();
             
+            /**
+             * Removes half of the local learnt clauses by activity. Learnt clauses in the core tier are never removed and
+             * learnt clauses in tier2 are only removed if they have not been used in a conflict since the last reduction.
+             * Locked, binary and permanent clauses are never removed.
+             */
+            void reduceDBTiered();
+            
+            /**
+             * Performs an inprocessing pass on the learnt clauses, i.e., subsumption, strengthening and vivification.
+             * Backtracks to decision level zero, hence it should only be called on restarts.
+             */
+            void inprocess();
+            
+            /**
+             * Preprocesses the problem clauses at decision level zero by failed literal probing, equivalent literal
+             * substitution, bounded variable elimination and blocked clause elimination. Only the Tseitin variables of
+             * the received formula are eliminated or substituted and only clauses whose literals are all unassigned are
+             * considered. Sets ok to false, if the clauses are found to be unsatisfiable.
+             * The assignments of the eliminated variables are not reconstructed, as they are never part of the model,
+             * which only consists of Boolean variables and the models of the backends.
+             */
+            void preprocess();
+            
+            /**
+             * @param _firstClause The position of the first problem clause to check.
+             * @return true, if a problem clause from the given position on contains a variable the preprocessing relies on.
+             */
+            bool touchesPreprocessing( int _firstClause ) const;
+            
+            /**
+             * Undoes the preprocessing, i.e., removes the clauses it introduced, attaches the clauses it eliminated and
+             * makes the eliminated variables eligible for decisions again. Backtracks to decision level zero.
+             * @param _removeUnits true, if also the literals found by failed literal probing are unassigned. As these
+             *                     literals are not recorded in the origins of learnt clauses, all learnt clauses are
+             *                     removed in this case.
+             */
+            void restorePreprocessing( bool _removeUnits );
+            
+            /**
+             * Assigns the negation of each literal of a variable which may be eliminated, which leads to a conflict
+             * by propagation, at decision level zero.
+             * @return false, if a conflict at decision level zero has been found.
+             */
+            bool probeFailedLiterals();
+            
+            /**
+             * Substitutes the variables, which may be eliminated and are equivalent to another literal by the binary
+             * clauses, by the representative of their equivalence class.
+             * @return false, if a literal has been found to be equivalent to its negation.
+             */
+            bool substituteEquivalentLiterals();
+            
+            /**
+             * Eliminates the variables, which may be eliminated and whose occurrences can be replaced by at most as many
+             * non-unit resolvents.
+             */
+            void eliminateVariables();
+            
+            /**
+             * Eliminates the clauses, which are blocked on a literal of a variable which may be eliminated, i.e., all
+             * resolvents on this literal are tautologies.
+             */
+            void eliminateBlockedClauses();
+            
+            /**
+             * Detaches the given clause, which is a problem clause or a clause introduced by the preprocessing, such
+             * that it is not considered anymore by the current preprocessing pass.
+             * @param _clause The clause to eliminate.
+             */
+            void eliminateClause( Minisat::CRef _clause );
+            
+            /**
+             * Adds a clause introduced by the preprocessing. As it is derived from several clauses, the learnt clauses
+             * depending on it are removed whenever a formula is removed.
+             * @param _clause The literals of the clause, which are unassigned and at least two.
+             */
+            void addPreprocessingClause( const Minisat::vec<Minisat::Lit>& _clause );
+            
+            /**
+             * Collects the clauses containing the given literal, which have not been eliminated by the current preprocessing pass.
+             * @param _lit The literal.
+             * @return The occurrence list of the given literal.
+             */
+            Minisat::vec<Minisat::CRef>& occurrences( Minisat::Lit _lit );
+            
+            /**
+             * Removes learnt clauses, which are subsumed by another clause, and strengthens learnt clauses by self-subsuming
+             * resolution. Only learnt clauses whose literals are all unassigned are considered.
+             */
+            void subsumeLearnts();
+            
+            /**
+             * Vivifies the learnt clauses of the core tier and tier2 with the highest activities.
+             */
+            void vivifyLearnts();
+            
+            /**
+             * Vivifies the given clause, i.e., assigns the negation of its literals one after another, propagates and removes
+             * all literals which are implied to be false or are not needed to obtain a conflict or a satisfied literal.
+             * @param _clause The clause to vivify, which must be attached and have no assigned literal.
+             * @return The number of removed literals.
+             */
+            int vivify( Minisat::CRef _clause );
+            
+            /**
+             * Removes the given literal from the given clause and attaches the clause again.
+             * @param _clause The clause to strengthen, which must not be locked.
+             * @param _lit The literal to remove.
+             */
+            void strengthenClause( Minisat::CRef _clause, Minisat::Lit _lit );
+            
+            /**
+             * @param _lits A clause or a vector of literals, which are assigned.
+             * @return The number of different decision levels of the given literals (literal blocks distance).
+             */
+            template<class Lits>
+            unsigned computeLBD( const Lits& _lits )
+            {
+                ++lbd_stamp;
+                unsigned result = 0;
+                for( int i = 0; i < _lits.size(); ++i )
+                {
+                    if( value( _lits[i] ) == l_Undef )
+                        continue;
+                    int l = level( Minisat::var( _lits[i] ) );
+                    if( lbd_levels.size() <= l )
+                        lbd_levels.growTo( l + 1, 0 );
+                    if( lbd_levels[l] != lbd_stamp )
+                    {
+                        lbd_levels[l] = lbd_stamp;
+                        ++result;
+                    }
+                }
+                return result;
+            }
+            
             void clearLearnts( int n );
             
             // Shrink 'cs' to contain only non-satisfied clauses.
@@ -1361,7 +1701,32 @@ namespace smtrat
              */
             inline bool locked( const Minisat::Clause& c )
             {
-                return value( c[0] ) == l_True && reason( Minisat::var( c[0] ) ) != Minisat::CRef_Undef && ca.lea( reason( Minisat::var( c[0] ) ) ) == &c;
+                int i = reasonPosition( c );
+                return value( c[i] ) == l_True && reason( Minisat::var( c[i] ) ) != Minisat::CRef_Undef && ca.lea( reason( Minisat::var( c[i] ) ) ) == &c;
+            }
+            
+            /**
+             * @param c A clause.
+             * @return The position of the literal the given clause can be the reason for. Binary clauses are propagated
+             *         without accessing them, hence their implied literal is not necessarily at the first position.
+             */
+            inline int reasonPosition( const Minisat::Clause& c ) const
+            {
+                return c.size() == 2 && value( c[0] ) != l_True ? 1 : 0;
+            }
+            
+            /**
+             * Moves the implied literal of the given reason clause to the first position, as required by the conflict analysis.
+             * @param c A clause being the reason for the assignment of one of its literals.
+             */
+            inline void fixReasonPosition( Minisat::Clause& c )
+            {
+                if( reasonPosition( c ) == 1 )
+                {
+                    Minisat::Lit tmp = c[0];
+                    c[0] = c[1];
+                    c[1] = tmp;
+                }
             }
             
             /**
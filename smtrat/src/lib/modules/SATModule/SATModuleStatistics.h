@@ -26,6 +26,28 @@ namespace smtrat
         size_t mPropagations;
         size_t mRestarts;
         size_t mDecisions;
+        size_t mLearntsKeptOnRemove;
+        size_t mLearntsRemovedOnRemove;
+        size_t mReductions;
+        size_t mLearntsDeleted;
+        size_t mInprocessings;
+        size_t mLearntsSubsumed;
+        size_t mLearntsStrengthened;
+        size_t mLearntsVivified;
+        size_t mLiteralsVivifiedAway;
+        size_t mPartialTheoryCalls;
+        size_t mSkippedTheoryCalls;
+        size_t mExplanationsReused;
+        size_t mExplanationsRederived;
+        size_t mCubes;
+        size_t mCubesSolved;
+        size_t mSharedClausesExported;
+        size_t mSharedClausesImported;
+        size_t mPreprocessings;
+        size_t mFailedLiterals;
+        size_t mSubstitutedVariables;
+        size_t mEliminatedVariables;
+        size_t mBlockedClauses;
 
     public:
         SATModuleStatistics( const std::string& _name ) : 
@@ -38,7 +60,29 @@ namespace smtrat
             mVarsWithPolarityTrue( 0 ), 
             mPropagations( 0 ), 
             mRestarts( 0 ), 
-            mDecisions( 0 )
+            mDecisions( 0 ),
+            mLearntsKeptOnRemove( 0 ),
+            mLearntsRemovedOnRemove( 0 ),
+            mReductions( 0 ),
+            mLearntsDeleted( 0 ),
+            mInprocessings( 0 ),
+            mLearntsSubsumed( 0 ),
+            mLearntsStrengthened( 0 ),
+            mLearntsVivified( 0 ),
+            mLiteralsVivifiedAway( 0 ),
+            mPartialTheoryCalls( 0 ),
+            mSkippedTheoryCalls( 0 ),
+            mExplanationsReused( 0 ),
+            mExplanationsRederived( 0 ),
+            mCubes( 0 ),
+            mCubesSolved( 0 ),
+            mSharedClausesExported( 0 ),
+            mSharedClausesImported( 0 ),
+            mPreprocessings( 0 ),
+            mFailedLiterals( 0 ),
+            mSubstitutedVariables( 0 ),
+            mEliminatedVariables( 0 ),
+            mBlockedClauses( 0 )
         {}
 
         ~SATModuleStatistics() {}
@@ -54,6 +98,28 @@ namespace smtrat
             Statistics::addKeyValuePair( "propagations", mPropagations );
             Statistics::addKeyValuePair( "decisions", mDecisions );
             Statistics::addKeyValuePair( "restarts", mRestarts );
+            Statistics::addKeyValuePair( "learnts_kept_on_remove", mLearntsKeptOnRemove );
+            Statistics::addKeyValuePair( "learnts_removed_on_remove", mLearntsRemovedOnRemove );
+            Statistics::addKeyValuePair( "reductions", mReductions );
+            Statistics::addKeyValuePair( "learnts_deleted", mLearntsDeleted );
+            Statistics::addKeyValuePair( "inprocessings", mInprocessings );
+            Statistics::addKeyValuePair( "learnts_subsumed", mLearntsSubsumed );
+            Statistics::addKeyValuePair( "learnts_strengthened", mLearntsStrengthened );
+            Statistics::addKeyValuePair( "learnts_vivified", mLearntsVivified );
+            Statistics::addKeyValuePair( "literals_vivified_away", mLiteralsVivifiedAway );
+            Statistics::addKeyValuePair( "partial_theory_calls", mPartialTheoryCalls );
+            Statistics::addKeyValuePair( "skipped_theory_calls", mSkippedTheoryCalls );
+            Statistics::addKeyValuePair( "explanations_reused", mExplanationsReused );
+            Statistics::addKeyValuePair( "explanations_rederived", mExplanationsRederived );
+            Statistics::addKeyValuePair( "cubes", mCubes );
+            Statistics::addKeyValuePair( "cubes_solved", mCubesSolved );
+            Statistics::addKeyValuePair( "shared_clauses_exported", mSharedClausesExported );
+            Statistics::addKeyValuePair( "shared_clauses_imported", mSharedClausesImported );
+            Statistics::addKeyValuePair( "preprocessings", mPreprocessings );
+            Statistics::addKeyValuePair( "failed_literals", mFailedLiterals );
+            Statistics::addKeyValuePair( "substituted_variables", mSubstitutedVariables );
+            Statistics::addKeyValuePair( "eliminated_variables", mEliminatedVariables );
+            Statistics::addKeyValuePair( "blocked_clauses", mBlockedClauses );
         }
 
         void lemmaLearned()
@@ -80,6 +146,98 @@ namespace smtrat
         {
             ++mRestarts;
         }
+
+        void learntsOnRemove( size_t _kept, size_t _removed )
+        {
+            mLearntsKeptOnRemove += _kept;
+            mLearntsRemovedOnRemove += _removed;
+        }
+
+        void reduce( size_t _deleted )
+        {
+            ++mReductions;
+            mLearntsDeleted += _deleted;
+        }
+
+        void inprocess()
+        {
+            ++mInprocessings;
+        }
+
+        void subsumed()
+        {
+            ++mLearntsSubsumed;
+        }
+
+        void strengthened()
+        {
+            ++mLearntsStrengthened;
+        }
+
+        void partialTheoryCall( bool _skipped )
+        {
+            if( _skipped )
+                ++mSkippedTheoryCalls;
+            else
+                ++mPartialTheoryCalls;
+        }
+
+        void explanationReused()
+        {
+            ++mExplanationsReused;
+        }
+
+        void explanationRederived()
+        {
+            ++mExplanationsRederived;
+        }
+
+        void cubes( size_t _cubes, size_t _solved )
+        {
+            mCubes += _cubes;
+            mCubesSolved += _solved;
+        }
+
+        void sharedClauseExported()
+        {
+            ++mSharedClausesExported;
+        }
+
+        void sharedClauseImported()
+        {
+            ++mSharedClausesImported;
+        }
+
+        void preprocess()
+        {
+            ++mPreprocessings;
+        }
+
+        void failedLiteral()
+        {
+            ++mFailedLiterals;
+        }
+
+        void substitutedVariable()
+        {
+            ++mSubstitutedVariables;
+        }
+
+        void eliminatedVariable()
+        {
+            ++mEliminatedVariables;
+        }
+
+        void blockedClause()
+        {
+            ++mBlockedClauses;
+        }
+
+        void vivified( size_t _removedLiterals )
+        {
+            ++mLearntsVivified;
+            mLiteralsVivifiedAway += _removedLiterals;
+        }
         
         size_t& rNrClauses()
         {
@@ -18,6 +18,8 @@ namespace smtrat
     
     enum class VARIABLE_ACTIVITY_STRATEGY : unsigned { NONE, MIN_COMPLEXITY_MAX_OCCURRENCES };
     
+    enum class TheoryCallPolicy : unsigned { EAGER, ADAPTIVE };
+    
     struct SATSettings1 : ModuleSettings
     {
 		static constexpr auto moduleName = "SATModule<SATSettings1>";
@@ -57,6 +59,97 @@ namespace smtrat
 		 *
 		 */
 		static const bool remove_satisfied = false; // This cannot be true as otherwise incremental sat solving won't work
+        /**
+         * If true, the received formulas each learnt clause has been derived from are recorded, such that removing
+         * a formula only removes the learnt clauses depending on it. Otherwise all learnt clauses are removed.
+         */
+        static const bool keep_learnts_on_remove = true;
+        /**
+         * If true, the learnt clauses are managed in three tiers according to their literal blocks distance (LBD): core
+         * clauses are never removed, tier2 clauses are kept as long as they take part in conflicts and only the remaining
+         * local clauses are reduced by activity. Otherwise half of the learnt clauses are removed by activity.
+         * Only the tiered reduction is applied to theory lemmas, i.e., if the received formula is not purely propositional.
+         */
+        static const bool lbd_tiered_learnts = false;
+        /**
+         * The maximal LBD of learnt clauses in the core tier.
+         */
+        static const unsigned lbd_core_tier = 2;
+        /**
+         * The maximal LBD of learnt clauses in tier2.
+         */
+        static const unsigned lbd_tier2 = 6;
+        /**
+         * If true, the learnt clauses are periodically subsumed, strengthened and vivified at restarts.
+         */
+        static const bool inprocessing = false;
+        /**
+         * The number of conflicts between two inprocessing passes.
+         */
+        static const unsigned inprocessing_interval = 5000;
+        /**
+         * The maximal number of literal visits of the subsumption in one inprocessing pass.
+         */
+        static const unsigned subsumption_effort = 10000000;
+        /**
+         * The maximal number of learnt clauses vivified in one inprocessing pass.
+         */
+        static const unsigned vivification_candidates = 1000;
+        /**
+         * The maximal number of partial theory calls skipped in a row by the adaptive theory call policy.
+         */
+        static const unsigned theory_call_max_interval = 32;
+        /**
+         * If true, the clauses explaining theory propagations and the theory lemmas are cached by their literals, such
+         * that a clause still present is reused as explanation instead of allocating a duplicate, and an explanation
+         * derived repeatedly is moved to the core tier. The latter only protects it from the reduction of the learnt
+         * clauses if lbd_tiered_learnts is enabled.
+         */
+        static const bool cache_theory_explanations = false;
+        /**
+         * The maximal number of cached explanations, above which the least recently used one is forgotten.
+         */
+        static const unsigned explanation_cache_limit = 100000;
+        /**
+         * If true, the search is split into cubes over the most active decision variables, which are solved by worker
+         * SATModules with their own backends sharing their short learnt clauses. Workers run in parallel only if
+         * SMTRAT_STRAT_PARALLEL_MODE is enabled and carl is built with THREAD_SAFE, otherwise a single worker solves the
+         * cubes one after another.
+         */
+        static const bool cube_and_conquer = false;
+        /**
+         * The number of variables the cubes consist of, i.e., the search is split into 2^cube_depth cubes.
+         */
+        static const unsigned cube_depth = 4;
+        /**
+         * The maximal number of workers solving cubes in parallel.
+         */
+        static const unsigned cube_workers = 4;
+        /**
+         * The maximal size of learnt clauses shared between the workers.
+         */
+        static const unsigned cube_share_size = 8;
+        /**
+         * If true, the clauses of the received formula are preprocessed before the search by failed literal probing,
+         * equivalent literal substitution, bounded variable elimination and blocked clause elimination. Only the Tseitin
+         * variables of the received formula are eliminated, never the abstractions of constraints, Boolean variables or
+         * variables of assumptions. The preprocessing is undone as soon as a formula is removed or a formula is added,
+         * whose clauses contain a variable the preprocessing relies on. Once undone, it is repeated only after the number
+         * of problem clauses has grown by half. The eliminated variables are not part of the model.
+         */
+        static const bool preprocessing = false;
+        /**
+         * The maximal number of occurrences of a variable eliminated by bounded variable elimination.
+         */
+        static const unsigned elimination_occurrence_limit = 16;
+        /**
+         * The maximal size of a resolvent introduced by bounded variable elimination.
+         */
+        static const unsigned elimination_resolvent_limit = 20;
+        /**
+         * The maximal number of propagations and literal visits in one preprocessing pass.
+         */
+        static const unsigned preprocessing_effort = 10000000;
 #ifdef __VS
         /**
          * 
@@ -74,6 +167,15 @@ namespace smtrat
          * 
          */
         static const VARIABLE_ACTIVITY_STRATEGY initial_variable_activities = VARIABLE_ACTIVITY_STRATEGY::NONE;
+        /**
+         * EAGER calls the backends whenever the passed formula has changed. ADAPTIVE learns the cost and the yield of
+         * the backends on partial assignments and skips partial calls accordingly. Full assignments are always checked.
+         */
+        static const TheoryCallPolicy theory_call_policy = TheoryCallPolicy::EAGER;
+        /**
+         * The fraction of the average time between two conflicts, which the adaptive policy may spend in partial theory calls.
+         */
+        static constexpr double theory_call_budget = 0.5;
 #else
         /**
          * 
@@ -91,6 +193,15 @@ namespace smtrat
          * 
          */
         static constexpr VARIABLE_ACTIVITY_STRATEGY initial_variable_activities = VARIABLE_ACTIVITY_STRATEGY::NONE;
+        /**
+         * EAGER calls the backends whenever the passed formula has changed. ADAPTIVE learns the cost and the yield of
+         * the backends on partial assignments and skips partial calls accordingly. Full assignments are always checked.
+         */
+        static constexpr TheoryCallPolicy theory_call_policy = TheoryCallPolicy::EAGER;
+        /**
+         * The fraction of the average time between two conflicts, which the adaptive policy may spend in partial theory calls.
+         */
+        static constexpr double theory_call_budget = 0.5;
         /**
          * 
          */
@@ -112,4 +223,35 @@ namespace smtrat
     {
         static const bool mc_sat = true;
     };
+    
+    struct SATSettingsInprocessing : SATSettings1
+    {
+        static const bool lbd_tiered_learnts = true;
+        static const bool inprocessing = true;
+    };
+    
+    struct SATSettingsAdaptiveTheoryCalls : SATSettings1
+    {
+#ifdef __VS
+        static const TheoryCallPolicy theory_call_policy = TheoryCallPolicy::ADAPTIVE;
+#else
+        static constexpr TheoryCallPolicy theory_call_policy = TheoryCallPolicy::ADAPTIVE;
+#endif
+    };
+    
+    struct SATSettingsExplanationCache : SATSettings1
+    {
+        static const bool lbd_tiered_learnts = true;
+        static const bool cache_theory_explanations = true;
+    };
+    
+    struct SATSettingsCubeAndConquer : SATSettings1
+    {
+        static const bool cube_and_conquer = true;
+    };
+    
+    struct SATSettingsPreprocessing : SATSettings1
+    {
+        static const bool preprocessing = true;
+    };
 }
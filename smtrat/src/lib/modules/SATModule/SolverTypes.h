@@ -138,6 +138,7 @@ static const unsigned PERMANENT_CLAUSE = 3;
 #define BITMASK_TYPE 0x03
 #define BITMASK_HASEXTRA 0x01
 #define BITMASK_RELOCED 0x01
+#define BITMASK_LBD 0x3f
 #define BITMASK_SIZE 0x3fff
 class Clause {
     struct {
@@ -145,7 +146,9 @@ class Clause {
         unsigned type      : 2;
         unsigned has_extra : 1;
         unsigned reloced   : 1;
-        unsigned size      : 26; }                        header;
+        unsigned used      : 1;
+        unsigned lbd       : 6;
+        unsigned size      : 19; }                        header;
     union { Lit lit; float act; uint32_t abs; CRef rel; } data[0];
 
     friend class ClauseAllocator;
@@ -157,6 +160,8 @@ class Clause {
         header.type      = _type & BITMASK_TYPE;
         header.has_extra = use_extra;
         header.reloced   = 0;
+        header.used      = 0;
+        header.lbd       = (unsigned)(ps.size() < BITMASK_LBD ? ps.size() : BITMASK_LBD);
         header.size      = (unsigned)ps.size() & BITMASK_SIZE;
 
         for (int i = 0; i < ps.size(); i++)
@@ -197,6 +202,12 @@ public:
     uint32_t     mark        ()      const   { return header.mark; }
     void         mark        (uint32_t m)    { header.mark = m & BITMASK_MARK; }
     const Lit&   last        ()      const   { return data[header.size-1].lit; }
+    // Literal blocks distance, i.e., number of different decision levels in the clause (saturated), and whether the
+    // clause took part in a conflict since the last reduction of the learnt clauses.
+    unsigned     lbd         ()      const   { return header.lbd; }
+    void         lbd         (unsigned l)    { header.lbd = (l < BITMASK_LBD ? l : BITMASK_LBD); }
+    bool         used        ()      const   { return header.used; }
+    void         used        (bool u)        { header.used = u; }
 
     bool         reloced     ()      const   { return header.reloced; }
     CRef         relocation  ()      const   { return data[0].rel; }
@@ -269,12 +280,14 @@ class ClauseAllocator : public RegionAllocator<uint32_t>
 
         if (c.reloced()) { cr = c.relocation(); return; }
 
-        cr = to.alloc(c, c.learnt());
+        cr = to.alloc(c, c.type());
         c.relocate(cr);
 
         // Copy extra data-fields:
         // (This could be cleaned-up. Generalize Clause-constructor to be applicable here instead?)
         to[cr].mark(c.mark());
+        to[cr].lbd(c.lbd());
+        to[cr].used(c.used());
         if (to[cr].learnt())         to[cr].activity() = c.activity();
         else if (to[cr].has_extra()) to[cr].calcAbstraction();
     }
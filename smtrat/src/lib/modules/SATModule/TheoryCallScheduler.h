@@ -0,0 +1,172 @@
+/**
+ * @file TheoryCallScheduler.h
+ *
+ * Adaptive scheduling of the theory calls of the SATModule on partial assignments.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <set>
+#include <vector>
+
+#include "../../solver/Module.h"
+
+namespace smtrat
+{
+    /**
+     * Decides whether the backends of the SATModule are called on a partial assignment.
+     *
+     * For every backend, the average duration of its partial checks and the fraction of them which are productive,
+     * i.e., which detect a conflict or provide lemmas, are learned. A partial check is only performed if
+     *  - enough partial checks have been skipped since the last one, where the number to skip grows as the yield of
+     *    the backends drops, and
+     *  - the time spent in partial checks since the last conflict, including the expected duration of this check, stays
+     *    within a budget relative to the average time between two conflicts.
+     * Checks of full assignments are never skipped, hence the scheduling only delays the detection of conflicts.
+     */
+    class TheoryCallScheduler
+    {
+        public:
+            typedef std::chrono::steady_clock clock;
+
+        private:
+            struct BackendInfo
+            {
+                /// The average duration of a partial check in microseconds.
+                double mCost = 0;
+                /// The average fraction of productive partial checks. Initially, backends are assumed to be productive.
+                double mYield = 1;
+            };
+
+            /// The weight of a new observation in the moving averages.
+            static constexpr double WEIGHT = 0.1;
+
+            /// The fraction of the average time between two conflicts, which may be spent in partial checks.
+            double mBudget;
+            /// The maximal number of partial checks skipped in a row, unless the budget is exhausted.
+            std::size_t mMaxInterval;
+            /// The learned information of the backends, indexed by their ids.
+            std::map<std::size_t,BackendInfo> mBackends;
+            /// The ids of the backends, which provided lemmas since the current check started.
+            std::set<std::size_t> mLemmaProviders;
+            /// The number of partial checks skipped since the last check.
+            std::size_t mSkipped;
+            /// The time spent in partial checks since the last conflict in microseconds.
+            double mSpentSinceConflict;
+            /// The average time between two conflicts in microseconds, or zero if there was no conflict yet.
+            double mConflictInterval;
+            clock::time_point mLastConflict;
+            clock::time_point mCheckStarted;
+
+            static double microseconds( clock::duration _duration )
+            {
+                return (double) std::chrono::duration_cast<std::chrono::microseconds>( _duration ).count();
+            }
+
+        public:
+            TheoryCallScheduler( double _budget, std::size_t _maxInterval ):
+                mBudget( _budget ),
+                mMaxInterval( std::max( _maxInterval, (std::size_t) 1 ) ),
+                mBackends(),
+                mLemmaProviders(),
+                mSkipped( 0 ),
+                mSpentSinceConflict( 0 ),
+                mConflictInterval( 0 ),
+                mLastConflict( clock::now() ),
+                mCheckStarted()
+            {}
+
+            /**
+             * @param _backends The backends to call.
+             * @return true, if the backends shall be called on the current partial assignment.
+             */
+            bool partialCheck( const std::vector<Module*>& _backends )
+            {
+                // nothing has been learned before the backends are known
+                if( _backends.empty() )
+                    return true;
+                double yield = 0;
+                double cost = 0;
+                for( const Module* backend : _backends )
+                {
+                    const BackendInfo& info = mBackends[backend->id()];
+                    yield = std::max( yield, info.mYield );
+                    cost += info.mCost;
+                }
+                std::size_t interval = yield * (double) mMaxInterval > 1 ? (std::size_t) (1 / yield) : mMaxInterval;
+                if( mSkipped + 1 < interval || (mConflictInterval > 0 && mSpentSinceConflict + cost > mBudget * mConflictInterval) )
+                {
+                    ++mSkipped;
+                    return false;
+                }
+                mSkipped = 0;
+                return true;
+            }
+
+            /**
+             * Notifies the scheduler that the backends are called now.
+             */
+            void checkStarted()
+            {
+                mLemmaProviders.clear();
+                mCheckStarted = clock::now();
+            }
+
+            /**
+             * Notifies the scheduler that the given backend provided lemmas. The SATModule clears the lemmas of its backends
+             * as soon as it has learned them, hence it has to be reported before.
+             * @param _backend The backend providing lemmas.
+             */
+            void lemmasProvided( const Module& _backend )
+            {
+                mLemmaProviders.insert( _backend.id() );
+            }
+
+            /**
+             * Notifies the scheduler that the backends have been called. The backends are run one after another until one
+             * of them determines the satisfiability, only these backends learn from this call. A backend has been
+             * productive if it found a conflict or provided lemmas.
+             * @param _backends The called backends in the order they are run.
+             * @param _partial true, if the assignment was partial.
+             */
+            void checkFinished( const std::vector<Module*>& _backends, bool _partial )
+            {
+                if( !_partial )
+                    return;
+                double duration = microseconds( clock::now() - mCheckStarted );
+                mSpentSinceConflict += duration;
+                std::size_t called = 0;
+                while( called < _backends.size() )
+                {
+                    Answer answer = _backends[called++]->solverState();
+                    if( answer == SAT || answer == UNSAT )
+                        break;
+                }
+                // The duration of a joint call is attributed to the called backends evenly.
+                double share = called == 0 ? 0 : duration / (double) called;
+                for( std::size_t i = 0; i < called; ++i )
+                {
+                    const Module* backend = _backends[i];
+                    bool productive = backend->solverState() == UNSAT || !backend->lemmas().empty() || mLemmaProviders.count( backend->id() ) > 0;
+                    BackendInfo& info = mBackends[backend->id()];
+                    info.mCost += WEIGHT * (share - info.mCost);
+                    info.mYield += WEIGHT * ((productive ? 1.0 : 0.0) - info.mYield);
+                }
+            }
+
+            /**
+             * Notifies the scheduler about a conflict, which renews the budget.
+             */
+            void conflict()
+            {
+                clock::time_point now = clock::now();
+                double interval = microseconds( now - mLastConflict );
+                mConflictInterval = mConflictInterval > 0 ? mConflictInterval + WEIGHT * (interval - mConflictInterval) : interval;
+                mLastConflict = now;
+                mSpentSinceConflict = 0;
+            }
+    };
+}
@@ -9,6 +9,7 @@
 
 #include <set>
 #include "../../Common.h"
+#include "FreeList.h"
 
 namespace vs
 {
@@ -41,6 +42,18 @@ namespace vs
             // Destructor:
             ~Condition();
 
+            // Conditions are created and deleted very frequently, hence their memory is pooled.
+            static void* operator new( std::size_t _size )
+            {
+                assert( _size == sizeof( Condition ) );
+                return FreeList<Condition>::instance().allocate();
+            }
+
+            static void operator delete( void* _condition )
+            {
+                FreeList<Condition>::instance().deallocate( _condition );
+            }
+
             // Methods:
             bool& rFlag() const
             {
@@ -0,0 +1,163 @@
+/**
+ * @file FreeList.h
+ *
+ * Pools the memory of the frequently created and deleted objects of the virtual substitution.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <vector>
+#include "../../config.h"
+
+#ifdef SMTRAT_STRAT_PARALLEL_MODE
+#include <mutex>
+#endif
+
+namespace vs
+{
+    /**
+     * Provides memory for objects of the given type. The memory of deleted objects is kept in a free list, which is
+     * embedded in the unused chunks, and reused for the next objects. New chunks are taken from blocks, whose size
+     * doubles with every block, such that deep state trees do not cause a call of the system allocator per object.
+     * The blocks are never returned to the system.
+     */
+    template<typename T>
+    class FreeList
+    {
+        private:
+            union Chunk
+            {
+                Chunk* mNext;
+                typename std::aligned_storage<sizeof(T), alignof(T)>::type mStorage;
+            };
+
+            /// The number of chunks in the first block.
+            static constexpr std::size_t FIRST_BLOCK_SIZE = 256;
+
+            /// The blocks from which the chunks are taken.
+            std::vector<std::unique_ptr<Chunk[]>> mBlocks;
+            /// The first chunk of the free list.
+            Chunk* mFree;
+            /// The number of chunks taken from the last block.
+            std::size_t mUsedInBlock;
+            /// The number of chunks of the last block.
+            std::size_t mBlockSize;
+            #ifdef SMTRAT_STRAT_PARALLEL_MODE
+            std::mutex mMutex;
+            #endif
+
+            FreeList():
+                mBlocks(),
+                mFree( nullptr ),
+                mUsedInBlock( 0 ),
+                mBlockSize( 0 )
+            {}
+
+        public:
+            FreeList( const FreeList& ) = delete;
+            FreeList& operator=( const FreeList& ) = delete;
+
+            /**
+             * @return The pool for objects of type T. It is never destroyed, as objects might still be deleted while
+             *         static objects are destroyed.
+             */
+            static FreeList& instance()
+            {
+                static FreeList* pool = new FreeList();
+                return *pool;
+            }
+
+            /**
+             * @return Memory for an object of type T.
+             */
+            void* allocate()
+            {
+                #ifdef SMTRAT_STRAT_PARALLEL_MODE
+                std::lock_guard<std::mutex> lock( mMutex );
+                #endif
+                if( mFree != nullptr )
+                {
+                    Chunk* result = mFree;
+                    mFree = mFree->mNext;
+                    return result;
+                }
+                if( mUsedInBlock == mBlockSize )
+                {
+                    if( mBlocks.empty() )
+                        mBlockSize = FIRST_BLOCK_SIZE;
+                    else
+                        mBlockSize *= 2;
+                    mBlocks.emplace_back( new Chunk[mBlockSize] );
+                    mUsedInBlock = 0;
+                }
+                return &mBlocks.back()[mUsedInBlock++];
+            }
+
+            /**
+             * Gives the memory of an object back to this pool.
+             * @param _object The memory, which must have been provided by allocate().
+             */
+            void deallocate( void* _object )
+            {
+                assert( _object != nullptr );
+                #ifdef SMTRAT_STRAT_PARALLEL_MODE
+                std::lock_guard<std::mutex> lock( mMutex );
+                #endif
+                Chunk* chunk = static_cast<Chunk*>( _object );
+                chunk->mNext = mFree;
+                mFree = chunk;
+            }
+    };
+
+    /**
+     * An allocator for node based containers, which takes single nodes from the free list of their type and falls back
+     * to std::allocator for arrays.
+     */
+    template<typename T>
+    class FreeListAllocator
+    {
+        public:
+            typedef T value_type;
+
+            template<typename U>
+            struct rebind
+            {
+                typedef FreeListAllocator<U> other;
+            };
+
+            FreeListAllocator() noexcept {}
+            template<typename U>
+            FreeListAllocator( const FreeListAllocator<U>& ) noexcept {}
+
+            T* allocate( std::size_t _n )
+            {
+                if( _n == 1 )
+                    return static_cast<T*>( FreeList<T>::instance().allocate() );
+                return std::allocator<T>().allocate( _n );
+            }
+
+            void deallocate( T* _p, std::size_t _n )
+            {
+                if( _n == 1 )
+                    FreeList<T>::instance().deallocate( _p );
+                else
+                    std::allocator<T>().deallocate( _p, _n );
+            }
+
+            template<typename U>
+            bool operator==( const FreeListAllocator<U>& ) const noexcept
+            {
+                return true;
+            }
+
+            template<typename U>
+            bool operator!=( const FreeListAllocator<U>& ) const noexcept
+            {
+                return false;
+            }
+    };
+}    // end namspace vs
@@ -14,6 +14,7 @@
 #include "carl/util/IDGenerator.h"
 #include "../../datastructures/VariableBounds.h"
 #include "VSSettings.h"
+#include "FreeList.h"
 
 #ifdef SMTRAT_DEVOPTION_Statistics
 #include "VSStatistics.h"
@@ -27,7 +28,7 @@ namespace vs
     // Type and object definitions.
     typedef std::set< carl::PointerSet<Condition> > ConditionSetSet;
     typedef std::set< ConditionSetSet > ConditionSetSetSet;
-    typedef std::list< const Condition* > ConditionList;
+    typedef std::list< const Condition*, FreeListAllocator<const Condition*> > ConditionList;
     typedef std::vector< ConditionList >  DisjunctionOfConditionConjunctions;
     
     typedef std::pair<size_t, std::pair<size_t, size_t> > UnsignedTriple;
@@ -203,6 +204,18 @@ namespace vs
          */
         ~State();
 
+        // The states of deep state trees are created and deleted very frequently, hence their memory is pooled.
+        static void* operator new( std::size_t _size )
+        {
+            assert( _size == sizeof( State ) );
+            return FreeList<State>::instance().allocate();
+        }
+
+        static void operator delete( void* _state )
+        {
+            FreeList<State>::instance().deallocate( _state );
+        }
+
         /**
          * @return The root of the state tree where this state is part from.
          */
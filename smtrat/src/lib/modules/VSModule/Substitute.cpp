@@ -6,8 +6,15 @@
  */
 
 #include "Substitute.h"
+#include "../../config.h"
+#include "carl/util/hash.h"
+#include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <limits>
+#if defined SMTRAT_STRAT_PARALLEL_MODE && defined THREAD_SAFE
+#include <thread>
+#endif
 
 //#define VS_DEBUG_SUBSTITUTION
 const unsigned MAX_NUM_OF_TERMS = 512;
@@ -591,6 +598,109 @@ namespace vs
         return result;
     }
 
+    SubstitutionCache::Key::Key( const smtrat::ConstraintT& _cons, const Substitution& _subs, const smtrat::EvalDoubleIntervalMap& _solutionSpace ):
+        mConstraint( _cons ),
+        mVariable( _subs.variable() ),
+        mTerm( _subs.term() ),
+        mType( _subs.type() ),
+        mSideCondition( _subs.sideCondition() ),
+        mBounds()
+    {
+        if( _solutionSpace.empty() )
+            return;
+        // Only the bounds on the variables, which can occur in the result, are relevant.
+        Variables vars = _cons.variables();
+        vars.insert( _subs.termVariables().begin(), _subs.termVariables().end() );
+        for( const auto& var : vars )
+        {
+            auto bound = _solutionSpace.find( var );
+            if( bound != _solutionSpace.end() )
+                mBounds.emplace_back( var, bound->second );
+        }
+    }
+    
+    bool SubstitutionCache::Key::operator==( const Key& _key ) const
+    {
+        return mConstraint == _key.mConstraint && mVariable == _key.mVariable && mType == _key.mType 
+            && mTerm == _key.mTerm && mSideCondition == _key.mSideCondition && mBounds == _key.mBounds;
+    }
+    
+    size_t SubstitutionCache::KeyHash::operator()( const Key& _key ) const
+    {
+        size_t result = 0;
+        carl::hash_add( result, _key.mConstraint, _key.mVariable, _key.mTerm, (size_t)_key.mType );
+        for( const auto& bound : _key.mBounds )
+            carl::hash_add( result, bound.first, bound.second );
+        return result;
+    }
+    
+    const SubstitutionCache::Result& SubstitutionCache::substitute( const smtrat::ConstraintT& _cons, const Substitution& _subs, bool _accordingPaper, const smtrat::EvalDoubleIntervalMap& _solutionSpace, bool& _hit )
+    {
+        Key key( _cons, _subs, _solutionSpace );
+        auto iter = mResults.find( key );
+        _hit = iter != mResults.end();
+        if( _hit )
+            return iter->second;
+        Result result;
+        result.mApplied = vs::substitute( _cons, _subs, result.mResult, _accordingPaper, result.mConflictingVariables, _solutionSpace );
+        return insert( std::move( key ), std::move( result ) );
+    }
+    
+    size_t SubstitutionCache::prefetch( const std::vector<std::pair<smtrat::ConstraintT,const Substitution*>>& _jobs, bool _accordingPaper, const smtrat::EvalDoubleIntervalMap& _solutionSpace, size_t _workers )
+    {
+        // The keys are created sequentially, as they gather the variables of the substitution terms lazily.
+        std::vector<Key> keys;
+        std::vector<const std::pair<smtrat::ConstraintT,const Substitution*>*> todo;
+        for( const auto& job : _jobs )
+        {
+            Key key( job.first, *job.second, _solutionSpace );
+            if( mResults.find( key ) == mResults.end() && std::find( keys.begin(), keys.end(), key ) == keys.end() )
+            {
+                keys.push_back( std::move( key ) );
+                todo.push_back( &job );
+            }
+        }
+        if( mCapacity > 0 && todo.size() > mCapacity )
+        {
+            keys.erase( keys.begin() + (long)mCapacity, keys.end() );
+            todo.erase( todo.begin() + (long)mCapacity, todo.end() );
+        }
+        std::vector<Result> results( todo.size() );
+        std::atomic<size_t> next( 0 );
+        auto work = [&]()
+        {
+            for( size_t i = next++; i < todo.size(); i = next++ )
+                results[i].mApplied = vs::substitute( todo[i]->first, *todo[i]->second, results[i].mResult, _accordingPaper, results[i].mConflictingVariables, _solutionSpace );
+        };
+        // The substitutions create polynomials and constraints, whose pools in carl are only guarded with THREAD_SAFE.
+        #if defined SMTRAT_STRAT_PARALLEL_MODE && defined THREAD_SAFE
+        std::vector<std::thread> threads;
+        for( size_t i = 1; i < std::min( _workers, todo.size() ); ++i )
+            threads.emplace_back( work );
+        work();
+        for( auto& thread : threads )
+            thread.join();
+        #else
+        (void)_workers;
+        work();
+        #endif
+        for( size_t i = 0; i < todo.size(); ++i )
+            insert( std::move( keys[i] ), std::move( results[i] ) );
+        return todo.size();
+    }
+    
+    const SubstitutionCache::Result& SubstitutionCache::insert( Key&& _key, Result&& _result )
+    {
+        if( mCapacity > 0 && mResults.size() >= mCapacity )
+        {
+            mResults.erase( mResults.find( *mInsertionOrder.front() ) );
+            mInsertionOrder.pop_front();
+        }
+        auto iter = mResults.emplace( std::move( _key ), std::move( _result ) ).first;
+        mInsertionOrder.push_back( &iter->first );
+        return iter->second;
+    }
+
     bool substituteNormal( const smtrat::ConstraintT& _cons,
                            const Substitution& _subs,
                            DisjunctionOfConstraintConjunctions& _result,
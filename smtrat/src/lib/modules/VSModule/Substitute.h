@@ -10,6 +10,8 @@
 #include "../../Common.h"
 #include "Substitution.h"
 #include <bitset>
+#include <deque>
+#include <unordered_map>
 
 /**
  * The maximal number of splits performed, if the left-hand side of a constraints is a product of 
@@ -186,6 +188,99 @@ namespace vs
      */
     bool substitute( const smtrat::ConstraintT&, const Substitution&, DisjunctionOfConstraintConjunctions&, bool _accordingPaper, carl::Variables&, const smtrat::EvalDoubleIntervalMap& );
     
+    /**
+     * A bounded cache of the results of substitute, which is shared by all states of a state tree. Sibling states and
+     * states, which are recreated after backtracking, often apply the same substitution to the same constraint. As 
+     * constraints are pooled, such a result is identified by the constraint, the substitution (without its origins)
+     * and the bounds of the solution space on the variables of the constraint and the substitution term. If the cache
+     * is full, the oldest result is dropped.
+     */
+    class SubstitutionCache
+    {
+        public:
+            /// The result of a substitution as provided by substitute.
+            struct Result
+            {
+                /// The return value of substitute.
+                bool mApplied;
+                /// The resulting disjunction of conjunctions of constraints.
+                DisjunctionOfConstraintConjunctions mResult;
+                /// The variables of the solution space, which are part of a conflict.
+                carl::Variables mConflictingVariables;
+            };
+            
+        private:
+            struct Key
+            {
+                smtrat::ConstraintT mConstraint;
+                carl::Variable mVariable;
+                smtrat::SqrtEx mTerm;
+                Substitution::Type mType;
+                smtrat::ConstraintsT mSideCondition;
+                std::vector<std::pair<carl::Variable,smtrat::DoubleInterval>> mBounds;
+                
+                Key( const smtrat::ConstraintT&, const Substitution&, const smtrat::EvalDoubleIntervalMap& );
+                bool operator==( const Key& ) const;
+            };
+            
+            struct KeyHash
+            {
+                size_t operator()( const Key& ) const;
+            };
+            
+            typedef std::unordered_map<Key,Result,KeyHash> ResultMap;
+            
+            /// The maximal number of stored results.
+            size_t mCapacity;
+            /// The stored results.
+            ResultMap mResults;
+            /// The keys of the stored results in the order of their insertion.
+            std::deque<const Key*> mInsertionOrder;
+            
+            const Result& insert( Key&& _key, Result&& _result );
+            
+        public:
+            /**
+             * @param _capacity The maximal number of stored results, where 0 means no limit.
+             */
+            SubstitutionCache( size_t _capacity ):
+                mCapacity( _capacity ),
+                mResults(),
+                mInsertionOrder()
+            {}
+            
+            /**
+             * Applies the given substitution to the given constraint, if its result is not yet stored in this cache.
+             * The arguments are the same as of substitute.
+             * @param _hit Is set to true, if the result has been stored in this cache.
+             * @return The result of the substitution.
+             */
+            const Result& substitute( const smtrat::ConstraintT& _cons, const Substitution& _subs, bool _accordingPaper, const smtrat::EvalDoubleIntervalMap& _solutionSpace, bool& _hit );
+            
+            /**
+             * Applies the given substitutions to the given constraints, if their results are not yet stored in this cache,
+             * and stores the results. If SMTRAT_STRAT_PARALLEL_MODE is enabled and carl is built with THREAD_SAFE, the
+             * substitutions are applied on up to the given number of threads, otherwise one after another.
+             * @param _jobs The constraints and the substitutions to apply to them.
+             * @param _accordingPaper See substitute.
+             * @param _solutionSpace See substitute.
+             * @param _workers The maximal number of threads to use.
+             * @return The number of results, which have been computed.
+             */
+            size_t prefetch( const std::vector<std::pair<smtrat::ConstraintT,const Substitution*>>& _jobs, bool _accordingPaper, const smtrat::EvalDoubleIntervalMap& _solutionSpace, size_t _workers );
+            
+            void clear()
+            {
+                mInsertionOrder.clear();
+                mResults.clear();
+            }
+            
+            size_t size() const
+            {
+                return mResults.size();
+            }
+    };
+    
     /**
      * Applies a substitution of a variable to a term, which is not minus infinity nor a to an square root expression plus an infinitesimal.
      * @param _cons   The constraint to substitute in.
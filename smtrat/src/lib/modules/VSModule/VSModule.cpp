@@ -31,7 +31,8 @@ namespace smtrat
         mAllVariables(),
         mFormulaConditionMap(),
         mRanking(),
-        mVariableVector()
+        mVariableVector(),
+        mSubstitutionCache( Settings::substitution_cache_size )
     {
         #ifdef SMTRAT_DEVOPTION_Statistics
         stringstream s;
@@ -1068,9 +1069,42 @@ namespace smtrat
         }
         else
             (*_condition).rFlag() = true;
+        // without worker threads, prefetching would only apply the substitutions earlier
+        #if defined SMTRAT_STRAT_PARALLEL_MODE && defined THREAD_SAFE
+        if( Settings::use_substitution_cache && Settings::substitution_workers > 1 && numberOfAddedChildren > 1 )
+            prefetchSubstitutions( _currentState );
+        #endif
         addStateToRanking( _currentState );
     }
 
+    template<class Settings>
+    void VSModule<Settings>::prefetchSubstitutions( State* _currentState )
+    {
+        // the jobs are grouped by the bounds, which the children use for their substitutions in substituteAll
+        std::map<const EvalDoubleIntervalMap*,std::vector<std::pair<ConstraintT,const Substitution*>>> jobs;
+        for( const State* child : _currentState->children() )
+        {
+            if( child->hasSubstitutionResults() )
+                continue;
+            const EvalDoubleIntervalMap& solBox = Settings::use_variable_bounds ? child->father().variableBounds().getIntervalMap() : EMPTY_EVAL_DOUBLE_INTERVAL_MAP;
+            auto& childJobs = jobs[&solBox];
+            const Substitution& subs = child->substitution();
+            for( const vs::Condition* cond : child->father().conditions() )
+            {
+                if( cond->constraint().hasVariable( subs.variable() ) )
+                    childJobs.emplace_back( cond->constraint(), &subs );
+            }
+        }
+        size_t computed = 0;
+        for( const auto& solBoxJobs : jobs )
+            computed += mSubstitutionCache.prefetch( solBoxJobs.second, Settings::virtual_substitution_according_paper, *solBoxJobs.first, Settings::substitution_workers );
+        #ifdef SMTRAT_DEVOPTION_Statistics
+        mpStatistics->prefetchSubstitutions( computed );
+        #else
+        (void)computed;
+        #endif
+    }
+
     template<class Settings>
     bool VSModule<Settings>::substituteAll( State* _currentState, ConditionList& _conditions )
     {
@@ -1110,7 +1144,20 @@ namespace smtrat
             {
                 DisjunctionOfConstraintConjunctions subResult;
                 carl::Variables conflVars;
-                bool substitutionCouldBeApplied = substitute( currentConstraint, currentSubs, subResult, Settings::virtual_substitution_according_paper, conflVars, solBox );
+                bool substitutionCouldBeApplied;
+                if( Settings::use_substitution_cache )
+                {
+                    bool hit;
+                    const vs::SubstitutionCache::Result& cached = mSubstitutionCache.substitute( currentConstraint, currentSubs, Settings::virtual_substitution_according_paper, solBox, hit );
+                    #ifdef SMTRAT_DEVOPTION_Statistics
+                    mpStatistics->substitutionCacheLookup( hit );
+                    #endif
+                    substitutionCouldBeApplied = cached.mApplied;
+                    subResult = cached.mResult;
+                    conflVars = cached.mConflictingVariables;
+                }
+                else
+                    substitutionCouldBeApplied = substitute( currentConstraint, currentSubs, subResult, Settings::virtual_substitution_according_paper, conflVars, solBox );
                 allSubstitutionsApplied &= substitutionCouldBeApplied;
                 // Create the the conditions according to the just created constraint prototypes.
                 if( substitutionCouldBeApplied && subResult.empty() )
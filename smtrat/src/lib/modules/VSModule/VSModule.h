@@ -59,6 +59,8 @@ namespace smtrat
              * variable for minus infinity (the first) and epsilon (the second).
              */
             mutable VarPairVector mVariableVector;
+            /// The results of substitutions, which are shared by all states of the state tree.
+            vs::SubstitutionCache mSubstitutionCache;
             
             #ifdef SMTRAT_DEVOPTION_Statistics
             /// Stores all collected statistics during solving.
@@ -139,6 +141,14 @@ namespace smtrat
              */
             bool substituteAll( vs::State* _currentState, vs::ConditionList& _conditions );
             
+            /**
+             * Applies the substitutions of the children of the given state, which have not yet been applied, to the conditions
+             * of the given state. This is done on Settings::substitution_workers threads and the results are stored in the 
+             * substitution cache, such that the children are processed as usual afterwards.
+             * @param _currentState The state whose children shall be prepared.
+             */
+            void prefetchSubstitutions( vs::State* _currentState );
+            
             /**
              * Applies the substitution of the given state to all conditions, which were recently added to it.
              * @param _currentState The currently considered state.
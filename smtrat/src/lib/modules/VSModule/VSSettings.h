@@ -42,6 +42,9 @@ namespace smtrat
         static const bool only_split_in_final_call                              = true;
         static const bool branch_and_bound_at_origin                            = false;
         static const bool use_fixed_variable_order                              = false;
+        static const bool use_substitution_cache                                = true;
+        static const size_t substitution_cache_size                             = 10000;
+        static const size_t substitution_workers                                = 1;
         static constexpr auto variable_valuation_strategy = VariableValuationStrategy::OPTIMIZE_BEST;
     };
     
@@ -64,6 +67,12 @@ namespace smtrat
         static const bool prefer_equation_over_all                              = true;
     };
     
+    struct VSSettings234Parallel : VSSettings234
+    {
+		static constexpr auto moduleName = "VSModule<VSSettings234Parallel>";
+        static const size_t substitution_workers                                = 4;
+    };
+    
     struct VSSettings2346 : VSSettings234
     {
 		static constexpr auto moduleName = "VSModule<VSSettings2346>";
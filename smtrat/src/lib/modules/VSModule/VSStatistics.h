@@ -33,6 +33,9 @@ namespace smtrat
         carl::uint mBJOmittedConstraints;
         carl::uint mVBOmittedTCs;
         carl::uint mBranchingLemmas;
+        carl::uint mSubstitutionCacheHits;
+        carl::uint mSubstitutionCacheMisses;
+        carl::uint mPrefetchedSubstitutions;
 
     public:
         VSStatistics( const std::string& _name ) : 
@@ -51,7 +54,10 @@ namespace smtrat
             mBackjumpings( 0 ),
             mBJOmittedConstraints( 0 ),
             mVBOmittedTCs( 0 ),
-            mBranchingLemmas( 0 )
+            mBranchingLemmas( 0 ),
+            mSubstitutionCacheHits( 0 ),
+            mSubstitutionCacheMisses( 0 ),
+            mPrefetchedSubstitutions( 0 )
         {}
 
         ~VSStatistics() {}
@@ -72,6 +78,9 @@ namespace smtrat
             Statistics::addKeyValuePair( "backjumpings", mBackjumpings );
             Statistics::addKeyValuePair( "omitted-constraints-by-backjumping", mBJOmittedConstraints );
             Statistics::addKeyValuePair( "branching-lemmas", mBranchingLemmas );
+            Statistics::addKeyValuePair( "substitution-cache-hits", mSubstitutionCacheHits );
+            Statistics::addKeyValuePair( "substitution-cache-misses", mSubstitutionCacheMisses );
+            Statistics::addKeyValuePair( "prefetched-substitutions", mPrefetchedSubstitutions );
         }
         
         void check()
@@ -94,6 +103,19 @@ namespace smtrat
             ++mBranchingLemmas;
         }
         
+        void substitutionCacheLookup( bool _hit )
+        {
+            if( _hit )
+                ++mSubstitutionCacheHits;
+            else
+                ++mSubstitutionCacheMisses;
+        }
+        
+        void prefetchSubstitutions( carl::uint _number )
+        {
+            mPrefetchedSubstitutions += _number;
+        }
+        
         void createTestCandidate()
         {
             ++mCreatedTCs;
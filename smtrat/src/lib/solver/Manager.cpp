@@ -460,6 +460,28 @@ namespace smtrat
         return backends;
     }
 
+    Module* Manager::cloneModule( const Module* _module, Conditionals& _foundAnswer )
+    {
+        #ifdef SMTRAT_STRAT_PARALLEL_MODE
+        std::lock_guard<std::mutex> lock(mBackendsMutex);
+        #endif
+        AbstractModuleFactory* factory = mStrategyGraph.getFactory(_module->threadPriority().second);
+        if (factory == nullptr) return nullptr;
+        Module* clone = factory->create(_module->pReceivedFormula(), _foundAnswer, this);
+        clone->setId(mGeneratedModules.size());
+        clone->setThreadPriority(_module->threadPriority());
+        mGeneratedModules.emplace_back(clone);
+        mBackendsOfModules[clone];
+        for(const auto& cons: _module->informedConstraints()) {
+            clone->inform(cons);
+        }
+        for(auto form = _module->rReceivedFormula().begin(); form != _module->rReceivedFormula().end(); form++) {
+            clone->add(form);
+        }
+        clone->setObjective( _module->objective() );
+        return clone;
+    }
+
     #ifdef SMTRAT_STRAT_PARALLEL_MODE
 	Answer Manager::runBackends(const std::vector<Module*>& _modules, bool _final, bool _full, bool _minimize) {
 		return mpThreadPool->runBackends(_modules, _final, _full, _minimize);
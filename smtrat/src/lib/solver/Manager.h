@@ -540,6 +540,15 @@ namespace smtrat
             std::vector<Module*> getBackends( Module*, std::atomic_bool* );
 #endif
             
+            /**
+             * Creates a module of the same type as the given module, which receives the same formula as the given module
+             * and obtains its own backends according to the strategy. The clone is deleted by the manager.
+             * @param _module The module to clone.
+             * @param _foundAnswer The conditionals, which terminate the checks of the clone.
+             * @return The clone, or nullptr, if the given module has not been created according to the strategy.
+             */
+            Module* cloneModule( const Module* _module, Conditionals& _foundAnswer );
+            
             #ifdef SMTRAT_STRAT_PARALLEL_MODE
             /**
              * Submits an enquiry of a module to solve its passed formula.
@@ -107,6 +107,7 @@ namespace smtrat
     Answer Module::check( bool _final, bool _full, bool _minimize )
     {
         SMTRAT_LOG_INFO("smtrat.module", __func__  << (_final ? " final" : " partial") << (_full ? " full" : " lazy" ) << " with module " << moduleName() << " (" << mId << ")");
+        SMTRAT_TRACE_SPAN( "module", moduleName() + "::check" );
         print("\t");
         mFinalCheck = _final;
         mFullCheck = _full;
@@ -129,7 +130,11 @@ namespace smtrat
             #endif
             return foundAnswer( SAT );
         }
-        Answer result = checkCore();
+        Answer result;
+        {
+            SMTRAT_TRACE_SPAN( "theory", moduleName() + "::checkCore" );
+            result = checkCore();
+        }
         #ifdef SMTRAT_DEVOPTION_MeasureTime
         stopCheckTimer();
         #endif
@@ -773,9 +778,17 @@ namespace smtrat
         return result;
     }
 
+    Module* Module::cloneModule( Conditionals& _foundAnswer ) const
+    {
+        if( mpManager == nullptr )
+            return nullptr;
+        return mpManager->cloneModule( this, _foundAnswer );
+    }
+
     Answer Module::runBackends( bool _final, bool _full, bool _minimize )
     {
         if( mpManager == NULL ) return UNKNOWN;
+        SMTRAT_TRACE_SPAN( "module", moduleName() + "::runBackends" );
         *mBackendsFoundAnswer = false;
         Answer result = UNKNOWN;
         // Update the propositions of the passed formula
@@ -29,6 +29,7 @@
 #include "ValidationSettings.h"
 #include "../config.h"
 #include "ModuleSettings.h"
+#include "../utilities/trace/SpanRecorder.h"
 
 namespace smtrat
 {
@@ -1057,6 +1058,14 @@ namespace smtrat
                 return Module::runBackends( mFinalCheck, mFullCheck, mMinimizingCheck );
             }
             
+            /**
+             * Creates a module of the same type as this module, which receives the same formula and obtains its own
+             * backends according to the strategy. The clone is deleted by the manager.
+             * @param _foundAnswer The conditionals, which terminate the checks of the clone.
+             * @return The clone, or nullptr, if this module has not been created by a manager according to the strategy.
+             */
+            Module* cloneModule( Conditionals& _foundAnswer ) const;
+            
             /**
              * Removes everything related to the sub-formula to remove from the passed formula in the backends of this module.
              * Afterwards the sub-formula is removed from the passed formula.
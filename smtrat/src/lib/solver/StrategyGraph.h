@@ -172,6 +172,11 @@ namespace smtrat {
 			return mRoot;
 		}
 		
+		AbstractModuleFactory* getFactory(std::size_t vertex) const {
+			assert(vertex < mVertices.size());
+			return mVertices[vertex].get();
+		}
+		
 		std::set<std::pair<thread_priority,AbstractModuleFactory*>> getBackends(std::size_t vertex, const carl::Condition& condition) const {
 			std::set<std::pair<thread_priority,AbstractModuleFactory*>> res;
 			SMTRAT_LOG_DEBUG("smtrat.strategygraph", "Getting backends for vertex " << vertex);
@@ -0,0 +1,30 @@
+/**
+ * @file PureSATPreprocessing.h
+ */
+#pragma once
+
+#include "../solver/Manager.h"
+
+#include "../modules/SATModule/SATModule.h"
+
+namespace smtrat
+{
+    /**
+     * Strategy description.
+     *
+     * A SATModule preprocessing the clauses of the received formula before the search.
+     *
+     */
+    class PureSATPreprocessing:
+        public Manager
+    {
+        public:
+            PureSATPreprocessing(): Manager() {
+				setStrategy({
+					addBackend<SATModule<SATSettingsPreprocessing>>()
+				});
+			}
+
+    };
+
+}    // namespace smtrat
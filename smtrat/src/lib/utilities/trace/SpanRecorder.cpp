@@ -0,0 +1,121 @@
+/**
+ * @file   SpanRecorder.cpp
+ *
+ */
+
+#include <fstream>
+
+#include "SpanRecorder.h"
+
+namespace smtrat {
+namespace trace {
+
+    TraceSettings* SpanRecorder::settings = new TraceSettings();
+    std::atomic<bool> SpanRecorder::mEnabled( false );
+
+    SpanRecorder::SpanRecorder():
+        mMutex(),
+        mBuffers(),
+        mOrigin( Clock::now() ),
+        mNumberOfSpans( 0 ),
+        mNumberOfDroppedSpans( 0 ),
+        mMaxEvents( settings->maxEvents() )
+    {}
+
+    SpanRecorder::~SpanRecorder()
+    {
+        std::lock_guard<std::mutex> lock( mMutex );
+        while( !mBuffers.empty() )
+        {
+            delete mBuffers.back();
+            mBuffers.pop_back();
+        }
+    }
+
+    SpanRecorder::ThreadBuffer& SpanRecorder::threadBuffer()
+    {
+        // The buffers are owned by the recorder, such that spans of finished threads are still exported.
+        static thread_local ThreadBuffer* buffer = nullptr;
+        if( buffer == nullptr )
+        {
+            std::lock_guard<std::mutex> lock( mMutex );
+            buffer = new ThreadBuffer();
+            buffer->mThread = mBuffers.size();
+            mBuffers.push_back( buffer );
+        }
+        return *buffer;
+    }
+
+    void SpanRecorder::record( const char* _category, std::string&& _name, Clock::time_point _start, Clock::time_point _end )
+    {
+        if( mNumberOfSpans.fetch_add( 1, std::memory_order_relaxed ) >= mMaxEvents )
+        {
+            mNumberOfDroppedSpans.fetch_add( 1, std::memory_order_relaxed );
+            return;
+        }
+        ThreadBuffer& buffer = threadBuffer();
+        buffer.mSpans.push_back( Span{ _category, std::move(_name), _start, _end, buffer.mThread } );
+    }
+
+    void SpanRecorder::clear()
+    {
+        std::lock_guard<std::mutex> lock( mMutex );
+        for( ThreadBuffer* buffer : mBuffers )
+            buffer->mSpans.clear();
+        mNumberOfSpans = 0;
+        mNumberOfDroppedSpans = 0;
+    }
+
+    static void writeJSONString( std::ostream& _out, const std::string& _str )
+    {
+        _out << '"';
+        for( char c : _str )
+        {
+            switch( c )
+            {
+                case '"': _out << "\\\""; break;
+                case '\\': _out << "\\\\"; break;
+                case '\n': _out << "\\n"; break;
+                case '\t': _out << "\\t"; break;
+                default: _out << c;
+            }
+        }
+        _out << '"';
+    }
+
+    void SpanRecorder::exportChromeTrace( std::ostream& _out )
+    {
+        std::lock_guard<std::mutex> lock( mMutex );
+        _out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+        bool first = true;
+        for( const ThreadBuffer* buffer : mBuffers )
+        {
+            for( const Span& span : buffer->mSpans )
+            {
+                if( !first )
+                    _out << ",";
+                first = false;
+                // Timestamps and durations of trace events are given in microseconds.
+                double ts = std::chrono::duration<double, std::micro>( span.mStart - mOrigin ).count();
+                double dur = std::chrono::duration<double, std::micro>( span.mEnd - span.mStart ).count();
+                _out << "\n{\"name\":";
+                writeJSONString( _out, span.mName );
+                _out << ",\"cat\":\"" << span.mCategory << "\",\"ph\":\"X\",\"ts\":" << ts << ",\"dur\":" << dur;
+                _out << ",\"pid\":1,\"tid\":" << span.mThread << "}";
+            }
+        }
+        _out << "\n],\"otherData\":{\"dropped_spans\":" << mNumberOfDroppedSpans.load() << "}}" << std::endl;
+    }
+
+    void SpanRecorder::exportTrace()
+    {
+        if( !settings->exportTrace() )
+            return;
+        std::ofstream file;
+        file.open( settings->tracePath(), std::ios::out | std::ios::trunc );
+        file.precision( 15 );
+        getInstance().exportChromeTrace( file );
+        file.close();
+    }
+}
+}
@@ -0,0 +1,157 @@
+/**
+ * @file   SpanRecorder.h
+ *
+ * Records scoped spans (e.g. module checks, SAT propagation, conflict analysis) of a solver run
+ * and exports them as Chrome trace events, which can be inspected as a flame view in chrome://tracing
+ * or similar tools. Recording is switched on at runtime; if it is switched off, a span costs a
+ * single relaxed atomic load.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include <carl/util/Singleton.h>
+
+#include "TraceSettings.h"
+
+namespace smtrat {
+namespace trace {
+
+    class SpanRecorder : public carl::Singleton<SpanRecorder>
+    {
+        friend carl::Singleton<SpanRecorder>;
+    public:
+        typedef std::chrono::steady_clock Clock;
+
+        /// A completed span.
+        struct Span
+        {
+            const char* mCategory;
+            std::string mName;
+            Clock::time_point mStart;
+            Clock::time_point mEnd;
+            std::size_t mThread;
+        };
+
+        static TraceSettings* settings;
+
+    private:
+        static std::atomic<bool> mEnabled;
+
+        /// All spans recorded by a single thread.
+        struct ThreadBuffer
+        {
+            std::size_t mThread;
+            std::vector<Span> mSpans;
+        };
+
+        std::mutex mMutex;
+        std::vector<ThreadBuffer*> mBuffers;
+        Clock::time_point mOrigin;
+        std::atomic<std::size_t> mNumberOfSpans;
+        std::atomic<std::size_t> mNumberOfDroppedSpans;
+        std::size_t mMaxEvents;
+
+        SpanRecorder();
+
+        ThreadBuffer& threadBuffer();
+
+    public:
+        ~SpanRecorder();
+
+        static bool enabled()
+        {
+            return mEnabled.load(std::memory_order_relaxed);
+        }
+
+        static void setEnabled( bool _enabled )
+        {
+            // Construct the recorder beforehand, as its construction fixes the origin of all timestamps.
+            if( _enabled )
+                getInstance();
+            mEnabled.store(_enabled, std::memory_order_relaxed);
+        }
+
+        void setMaxEvents( std::size_t _maxEvents )
+        {
+            mMaxEvents = _maxEvents;
+        }
+
+        std::size_t numberOfDroppedSpans() const
+        {
+            return mNumberOfDroppedSpans.load();
+        }
+
+        /**
+         * Stores a completed span for the calling thread.
+         * @param _category The category of the span (e.g. "module" or "sat").
+         * @param _name The name of the span.
+         * @param _start The point in time the span started.
+         * @param _end The point in time the span ended.
+         */
+        void record( const char* _category, std::string&& _name, Clock::time_point _start, Clock::time_point _end );
+
+        /**
+         * Removes all recorded spans.
+         */
+        void clear();
+
+        /**
+         * Writes all recorded spans as Chrome trace event JSON (complete events, phase "X").
+         * @param _out The stream to write to.
+         */
+        void exportChromeTrace( std::ostream& _out );
+
+        /**
+         * Writes all recorded spans to the file given by the trace settings, if exporting is enabled.
+         */
+        static void exportTrace();
+    };
+
+    /**
+     * Measures the lifetime of this object and records it as a span, if recording is enabled.
+     * The name is only computed if recording is enabled.
+     */
+    class ScopedSpan
+    {
+    private:
+        bool mActive;
+        const char* mCategory;
+        std::string mName;
+        SpanRecorder::Clock::time_point mStart;
+
+    public:
+        template<typename NameGetter>
+        ScopedSpan( const char* _category, NameGetter&& _name ):
+            mActive( SpanRecorder::enabled() ),
+            mCategory( _category )
+        {
+            if( mActive )
+            {
+                mName = _name();
+                mStart = SpanRecorder::Clock::now();
+            }
+        }
+
+        ScopedSpan( const ScopedSpan& ) = delete;
+        ScopedSpan& operator=( const ScopedSpan& ) = delete;
+
+        ~ScopedSpan()
+        {
+            if( mActive )
+                SpanRecorder::getInstance().record( mCategory, std::move(mName), mStart, SpanRecorder::Clock::now() );
+        }
+    };
+}
+}
+
+#define SMTRAT_TRACE_CONCAT_IMPL(a, b) a ## b
+#define SMTRAT_TRACE_CONCAT(a, b) SMTRAT_TRACE_CONCAT_IMPL(a, b)
+/// Records a span from this statement to the end of the enclosing scope.
+#define SMTRAT_TRACE_SPAN(category, name) smtrat::trace::ScopedSpan SMTRAT_TRACE_CONCAT(__smtrat_span_, __LINE__)( category, [&]() -> std::string { return name; } )
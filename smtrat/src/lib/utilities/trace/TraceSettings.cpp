@@ -0,0 +1,54 @@
+/**
+ * @file   TraceSettings.cpp
+ *
+ */
+#include "TraceSettings.h"
+#include "SpanRecorder.h"
+
+namespace smtrat {
+TraceSettings::TraceSettings() :
+    mExportTrace(false),
+    mTracePath("trace.json"),
+    mMaxEvents(4000000)
+{
+
+}
+
+void TraceSettings::printHelp(const std::string& prefix) const
+{
+    std::cout << prefix <<  "Seperate options by a comma." << std::endl;
+    std::cout << prefix <<  "Options:" << std::endl;
+    std::cout << prefix <<  "\t export[=<path>] \t Record spans of the solver run and write them as Chrome trace events." << std::endl;
+    std::cout << prefix <<  "\t\t\t\t If path is not set, trace.json is used." << std::endl;
+    std::cout << prefix <<  "\t limit=<n> \t\t Stop recording after n spans (default 4000000)." << std::endl;
+}
+
+    void TraceSettings::parseCmdOption(const std::string& keyValueString)
+    {
+        std::map<std::string, std::string> keyvalues = splitIntoKeyValues(keyValueString);
+        mExportTrace = setNonEmptyValueIfKeyExists(keyvalues, mTracePath, "export") || mExportTrace;
+        std::string limit;
+        if( setValueIfKeyExists(keyvalues, limit, "limit") && !limit.empty() )
+        {
+            mMaxEvents = std::stoul(limit);
+        }
+        trace::SpanRecorder::getInstance().setMaxEvents(mMaxEvents);
+        trace::SpanRecorder::setEnabled(mExportTrace);
+    }
+
+    bool TraceSettings::exportTrace() const
+    {
+        return mExportTrace;
+    }
+
+    const std::string& TraceSettings::tracePath() const
+    {
+        return mTracePath;
+    }
+
+    std::size_t TraceSettings::maxEvents() const
+    {
+        return mMaxEvents;
+    }
+
+}
@@ -0,0 +1,27 @@
+/**
+ * @file   TraceSettings.h
+ *
+ */
+#pragma once
+
+#include <iostream>
+#include "../../solver/RuntimeSettings.h"
+
+namespace smtrat {
+class TraceSettings : public RuntimeSettings
+{
+protected:
+    bool        mExportTrace;
+    std::string mTracePath;
+    std::size_t mMaxEvents;
+public:
+    TraceSettings();
+
+    void parseCmdOption(const std::string& keyValueString);
+    void printHelp(const std::string& prefix) const;
+
+    bool exportTrace() const;
+    const std::string& tracePath() const;
+    std::size_t maxEvents() const;
+};
+}
@@ -0,0 +1,68 @@
+#include <boost/test/unit_test.hpp>
+
+#include <limits>
+
+#include "../../lib/datastructures/lra/Numeric.h"
+
+using namespace smtrat;
+using smtrat::lra::Numeric;
+
+BOOST_AUTO_TEST_SUITE(Test_Numeric);
+
+BOOST_AUTO_TEST_CASE(Overflow)
+{
+	long max = std::numeric_limits<long>::max();
+	Numeric a(max);
+	Numeric b(1);
+	// the sum does not fit into a long and is stored as a Rational
+	Numeric sum = a + b;
+	BOOST_CHECK(sum.content() == Rational(max) + Rational(1));
+	BOOST_CHECK(sum > a);
+	// the difference fits again
+	BOOST_CHECK(sum - b == a);
+	BOOST_CHECK((sum - b).content() == Rational(max));
+	
+	Numeric product = a * a;
+	BOOST_CHECK(product.content() == Rational(max) * Rational(max));
+	BOOST_CHECK(product / a == a);
+	
+	Numeric fraction = Numeric(1) / a;
+	BOOST_CHECK((fraction * fraction).content() == Rational(1) / (Rational(max) * Rational(max)));
+	BOOST_CHECK(fraction + fraction == Numeric(2) / a);
+	
+	// the smallest long is not stored inline, such that its negation does not overflow
+	Numeric min(std::numeric_limits<long>::min());
+	BOOST_CHECK((-min).content() == -Rational(std::numeric_limits<long>::min()));
+	BOOST_CHECK(min < -a);
+}
+
+BOOST_AUTO_TEST_CASE(Floor)
+{
+	BOOST_CHECK(Numeric(7).floor() == Numeric(7));
+	BOOST_CHECK((Numeric(7) / Numeric(2)).floor() == Numeric(3));
+	BOOST_CHECK((Numeric(-7) / Numeric(2)).floor() == Numeric(-4));
+	BOOST_CHECK((Numeric(-6) / Numeric(2)).floor() == Numeric(-3));
+	BOOST_CHECK(carl::floor(Numeric(-1) / Numeric(3)) == Numeric(-1));
+	
+	Numeric large = Numeric(std::numeric_limits<long>::max()) * Numeric(4) + Numeric(1);
+	BOOST_CHECK((large / Numeric(4)).floor() == Numeric(std::numeric_limits<long>::max()));
+	BOOST_CHECK((-large / Numeric(4)).floor() == -Numeric(std::numeric_limits<long>::max()) - Numeric(1));
+}
+
+BOOST_AUTO_TEST_CASE(Mod)
+{
+	BOOST_CHECK(lra::mod(Numeric(7), Numeric(3)) == Numeric(1));
+	BOOST_CHECK(lra::mod(Numeric(-7), Numeric(3)) == Numeric(-1));
+	BOOST_CHECK(lra::mod(Numeric(6), Numeric(3)) == Numeric(0));
+	
+	// the inline and the Rational representation yield the same remainders
+	Numeric large = Numeric(std::numeric_limits<long>::max()) * Numeric(3) + Numeric(2);
+	BOOST_CHECK(lra::mod(large, Numeric(3)) == Numeric(2));
+	BOOST_CHECK(lra::mod(-large, Numeric(3)) == Numeric(-2));
+	
+	BOOST_CHECK(carl::div(Numeric(-7), Numeric(2)) == Numeric(-3));
+	BOOST_CHECK(carl::gcd(Numeric(12), Numeric(-18)) == Numeric(6));
+	BOOST_CHECK(carl::lcm(Numeric(4), Numeric(6)) == Numeric(12));
+}
+
+BOOST_AUTO_TEST_SUITE_END();
@@ -0,0 +1,80 @@
+#include <boost/test/unit_test.hpp>
+
+#include "../../lib/modules/EQModule/EQModule.h"
+
+using namespace smtrat;
+
+namespace
+{
+	/// Passes formulas to a single EQModule the same way the manager does.
+	class EQModuleInput
+	{
+	public:
+		ModuleInput mInput;
+		Conditionals mConditionals;
+		EQModule<EQSettings1> mModule;
+
+		EQModuleInput(): mInput(), mConditionals(), mModule(&mInput, nullptr, mConditionals) {}
+
+		ModuleInput::iterator add(const FormulaT& f) {
+			mModule.inform(f);
+			auto it = mInput.add(f).first;
+			mModule.add(it);
+			return it;
+		}
+		void remove(ModuleInput::iterator it) {
+			mModule.remove(it);
+			mInput.erase(it);
+		}
+		FormulaSetT infeasibleSubset() const {
+			BOOST_REQUIRE(!mModule.infeasibleSubsets().empty());
+			return mModule.infeasibleSubsets().front();
+		}
+	};
+}
+
+BOOST_AUTO_TEST_SUITE(Test_EQModule);
+
+BOOST_AUTO_TEST_CASE(ProofForest_Reconnect)
+{
+	carl::Sort sort = newSort("EQModuleTestSort");
+	carl::UVariable a(carl::freshUninterpretedVariable("a"), sort);
+	carl::UVariable b(carl::freshUninterpretedVariable("b"), sort);
+	carl::UVariable c(carl::freshUninterpretedVariable("c"), sort);
+	carl::UVariable d(carl::freshUninterpretedVariable("d"), sort);
+	FormulaT ab(carl::UEquality(a, b, false));
+	FormulaT bc(carl::UEquality(b, c, false));
+	FormulaT cd(carl::UEquality(c, d, false));
+	FormulaT ac(carl::UEquality(a, c, false));
+	FormulaT ad(carl::UEquality(a, d, true));
+
+	EQModuleInput solver;
+	// a = b, b = c and c = d form the proof forest, a = c is not part of it
+	solver.add(ab);
+	auto itBC = solver.add(bc);
+	solver.add(cd);
+	auto itAC = solver.add(ac);
+	auto itAD = solver.add(ad);
+	BOOST_CHECK(solver.mModule.check() == UNSAT);
+	BOOST_CHECK(solver.infeasibleSubset() == FormulaSetT({ab, bc, cd, ad}));
+	solver.remove(itAD);
+	BOOST_CHECK(solver.mModule.check() == SAT);
+
+	// removing the forest edge b = c keeps the component connected, the cut off tree is linked by a = c
+	solver.remove(itBC);
+	itAD = solver.add(ad);
+	BOOST_CHECK(solver.mModule.check() == UNSAT);
+	BOOST_CHECK(solver.infeasibleSubset() == FormulaSetT({ac, cd, ad}));
+	solver.remove(itAD);
+
+	// asserting b = c again does not merge classes, hence it is not part of the forest
+	itBC = solver.add(bc);
+	solver.remove(itAC);
+	itAD = solver.add(ad);
+	BOOST_CHECK(solver.mModule.check() == UNSAT);
+	BOOST_CHECK(solver.infeasibleSubset() == FormulaSetT({ab, bc, cd, ad}));
+	solver.remove(itAD);
+	BOOST_CHECK(solver.mModule.check() == SAT);
+}
+
+BOOST_AUTO_TEST_SUITE_END();
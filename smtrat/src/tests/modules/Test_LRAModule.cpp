@@ -0,0 +1,121 @@
+#include <boost/test/unit_test.hpp>
+
+#include "../../lib/solver/Manager.h"
+#include "../../lib/modules/SATModule/SATModule.h"
+#include "../../lib/modules/LRAModule/LRAModule.h"
+
+using namespace smtrat;
+
+namespace
+{
+	template<typename LRASettings>
+	class SATLRA: public Manager
+	{
+	public:
+		SATLRA(): Manager() {
+			setStrategy({
+				addBackend<SATModule<SATSettings1>>({
+					addBackend<LRAModule<LRASettings>>()
+				})
+			});
+		}
+	};
+
+	bool satisfies(const Model& model, const std::vector<FormulaT>& formulas) {
+		for (const auto& f: formulas) {
+			auto res = carl::model::evaluate(f, model);
+			if (!res.isBool() || !res.asBool()) return false;
+		}
+		return true;
+	}
+}
+
+BOOST_AUTO_TEST_SUITE(Test_LRAModule);
+
+BOOST_AUTO_TEST_CASE(CompressEntries_Incremental)
+{
+	carl::Variable x = carl::freshRealVariable("x");
+	carl::Variable y = carl::freshRealVariable("y");
+	carl::Variable z = carl::freshRealVariable("z");
+	carl::Variable w = carl::freshRealVariable("w");
+
+	// Every check pivots, hence the entries are compressed before the pivot searches (TableauSettings1::compress_entries).
+	std::vector<FormulaT> formulas = {
+		FormulaT(ConstraintT(Poly(x) + Poly(y) - Rational(2), carl::Relation::GEQ)),
+		FormulaT(ConstraintT(Poly(x) - Poly(y), carl::Relation::LEQ)),
+		FormulaT(ConstraintT(Poly(y) + Poly(z) - Rational(3), carl::Relation::LEQ)),
+		FormulaT(ConstraintT(Poly(x) + Poly(z) - Rational(2), carl::Relation::GEQ)),
+		FormulaT(ConstraintT(Poly(z) - Poly(x) + Rational(1), carl::Relation::GEQ))
+	};
+	SATLRA<LRASettings1> solver;
+	for (const auto& f: formulas) solver.add(f);
+	BOOST_CHECK(solver.check() == SAT);
+	BOOST_CHECK(satisfies(solver.model(), formulas));
+
+	// Implies x >= 7, z <= -4 and z >= 6.
+	solver.push();
+	solver.add(FormulaT(ConstraintT(Poly(x) + Poly(y) + Poly(z) - Rational(10), carl::Relation::GEQ)));
+	BOOST_CHECK(solver.check() == UNSAT);
+	solver.pop();
+	BOOST_CHECK(solver.check() == SAT);
+	BOOST_CHECK(satisfies(solver.model(), formulas));
+
+	// The removal of the rows above leaves unused entries, which must not be copied by the compression.
+	for (int i = 1; i <= 4; ++i) {
+		solver.push();
+		std::vector<FormulaT> added = {
+			FormulaT(ConstraintT(Poly(w) - Poly(x) - Poly(y) - Rational(i), carl::Relation::EQ)),
+			FormulaT(ConstraintT(Poly(w) - Poly(z) - Rational(i), carl::Relation::GEQ)),
+			FormulaT(ConstraintT(Poly(x) + Poly(y) + Poly(z) + Poly(w) - Rational(2*i+5), carl::Relation::LEQ))
+		};
+		for (const auto& f: added) solver.add(f);
+		BOOST_CHECK(solver.check() == SAT);
+		BOOST_CHECK(satisfies(solver.model(), formulas));
+		BOOST_CHECK(satisfies(solver.model(), added));
+		solver.pop();
+	}
+	BOOST_CHECK(solver.check() == SAT);
+	BOOST_CHECK(satisfies(solver.model(), formulas));
+}
+
+BOOST_AUTO_TEST_CASE(FloatSimplex)
+{
+	// Enough rows for the floating-point search (TableauSettings::float_simplex_min_rows).
+	const std::size_t n = 60;
+	std::vector<carl::Variable> vars;
+	for (std::size_t i = 0; i <= n + 1; ++i) vars.push_back(carl::freshRealVariable("x" + std::to_string(i)));
+	std::vector<FormulaT> formulas;
+	for (std::size_t i = 0; i < n; ++i) {
+		formulas.emplace_back(ConstraintT(Poly(vars[i]) + Rational(2)*vars[i+1] - Poly(vars[i+2]) - Rational(i), carl::Relation::GEQ));
+		formulas.emplace_back(ConstraintT(Poly(vars[i]) - Poly(vars[i+1]) - Rational(3), carl::Relation::LEQ));
+	}
+	SATLRA<LRASettingsFloat> floatSolver;
+	SATLRA<LRASettings1> exactSolver;
+	for (const auto& f: formulas) {
+		floatSolver.add(f);
+		exactSolver.add(f);
+	}
+	BOOST_CHECK(floatSolver.check() == SAT);
+	BOOST_CHECK(exactSolver.check() == SAT);
+	BOOST_CHECK(satisfies(floatSolver.model(), formulas));
+
+	// x0 - x1 >= 1, ..., x(n-1) - xn >= 1 and xn - x0 >= 0 are conflicting.
+	floatSolver.push();
+	exactSolver.push();
+	for (std::size_t i = 0; i < n; ++i) {
+		FormulaT f(ConstraintT(Poly(vars[i]) - Poly(vars[i+1]) - Rational(1), carl::Relation::GEQ));
+		floatSolver.add(f);
+		exactSolver.add(f);
+	}
+	FormulaT cycle(ConstraintT(Poly(vars[n]) - Poly(vars[0]), carl::Relation::GEQ));
+	floatSolver.add(cycle);
+	exactSolver.add(cycle);
+	BOOST_CHECK(floatSolver.check() == UNSAT);
+	BOOST_CHECK(exactSolver.check() == UNSAT);
+	floatSolver.pop();
+	exactSolver.pop();
+	BOOST_CHECK(floatSolver.check() == SAT);
+	BOOST_CHECK(satisfies(floatSolver.model(), formulas));
+}
+
+BOOST_AUTO_TEST_SUITE_END();
@@ -0,0 +1,86 @@
+#include <boost/test/unit_test.hpp>
+
+#include "../../lib/strategies/PureSATPreprocessing.h"
+#include "../../lib/modules/SATModule/TheoryCallScheduler.h"
+
+using namespace smtrat;
+
+BOOST_AUTO_TEST_SUITE(Test_SATModule);
+
+BOOST_AUTO_TEST_CASE(Preprocessing_Incremental)
+{
+	FormulaT a(carl::freshBooleanVariable("a"));
+	FormulaT b(carl::freshBooleanVariable("b"));
+	FormulaT c(carl::freshBooleanVariable("c"));
+	FormulaT e(carl::freshBooleanVariable("e"));
+	FormulaT ab(carl::FormulaType::AND, a, b);
+	FormulaT notAc(carl::FormulaType::AND, FormulaT(carl::FormulaType::NOT, a), c);
+	
+	PureSATPreprocessing solver;
+	// the Tseitin variables of both conjunctions may be eliminated
+	solver.add(FormulaT(carl::FormulaType::OR, ab, notAc));
+	BOOST_CHECK(solver.check() == SAT);
+	
+	// reuses the Tseitin variable of (and a b), hence the preprocessing has to be undone
+	solver.push();
+	solver.add(FormulaT(carl::FormulaType::OR, ab, e));
+	solver.add(FormulaT(carl::FormulaType::NOT, e));
+	solver.add(FormulaT(carl::FormulaType::NOT, b));
+	BOOST_CHECK(solver.check() == UNSAT);
+	solver.pop();
+	BOOST_CHECK(solver.check() == SAT);
+	
+	// does not touch the preprocessed variables
+	solver.push();
+	solver.add(FormulaT(carl::FormulaType::NOT, b));
+	solver.add(FormulaT(carl::FormulaType::NOT, c));
+	BOOST_CHECK(solver.check() == UNSAT);
+	solver.pop();
+	
+	solver.push();
+	solver.add(FormulaT(carl::FormulaType::NOT, c));
+	BOOST_CHECK(solver.check() == SAT);
+	BOOST_CHECK(solver.model().at(a.boolean()).asBool());
+	BOOST_CHECK(solver.model().at(b.boolean()).asBool());
+	solver.pop();
+}
+
+BOOST_AUTO_TEST_CASE(TheoryCallScheduler_Lemmas)
+{
+	ModuleInput input;
+	Conditionals conditionals;
+	Module lemmaBackend(&input, conditionals);
+	Module idleBackend(&input, conditionals);
+	lemmaBackend.setId(1);
+	idleBackend.setId(2);
+	FormulaT a(carl::freshBooleanVariable("a"));
+	FormulaT lemma(carl::FormulaType::OR, a, FormulaT(carl::FormulaType::NOT, a));
+
+	// the SATModule clears the lemmas after learning them, which is before the check is finished
+	TheoryCallScheduler lemmaScheduler(0.5, 8);
+	std::vector<Module*> lemmaBackends({&lemmaBackend});
+	for (std::size_t i = 0; i < 100; ++i) {
+		BOOST_CHECK(lemmaScheduler.partialCheck(lemmaBackends));
+		lemmaScheduler.checkStarted();
+		lemmaBackend.addLemma(lemma);
+		lemmaScheduler.lemmasProvided(lemmaBackend);
+		lemmaBackend.clearLemmas();
+		lemmaScheduler.checkFinished(lemmaBackends, true);
+	}
+
+	// unproductive backends are called less often
+	TheoryCallScheduler idleScheduler(0.5, 8);
+	std::vector<Module*> idleBackends({&idleBackend});
+	std::size_t skipped = 0;
+	for (std::size_t i = 0; i < 100; ++i) {
+		if (!idleScheduler.partialCheck(idleBackends)) {
+			++skipped;
+			continue;
+		}
+		idleScheduler.checkStarted();
+		idleScheduler.checkFinished(idleBackends, true);
+	}
+	BOOST_CHECK(skipped > 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END();
@@ -0,0 +1,100 @@
+#include <boost/test/unit_test.hpp>
+
+#include "../../lib/modules/VSModule/FreeList.h"
+#include "../../lib/modules/VSModule/Substitute.h"
+
+#include <cstdint>
+#include <list>
+#include <set>
+
+using namespace smtrat;
+
+BOOST_AUTO_TEST_SUITE(Test_VSModule);
+
+BOOST_AUTO_TEST_CASE(SubstitutionCache)
+{
+	carl::Variable x = carl::freshRealVariable("x");
+	carl::Variable y = carl::freshRealVariable("y");
+	ConstraintT c1(Poly(x)*x - Poly(y), carl::Relation::LEQ);
+	ConstraintT c2(Poly(x) + Poly(y) - Rational(1), carl::Relation::LESS);
+	vs::Substitution s1(x, SqrtEx(Poly(y) + Rational(1)), vs::Substitution::NORMAL, carl::PointerSet<vs::Condition>());
+	vs::Substitution s2(x, SqrtEx(Poly(y) - Rational(1)), vs::Substitution::NORMAL, carl::PointerSet<vs::Condition>());
+	EvalDoubleIntervalMap noBounds;
+	EvalDoubleIntervalMap bounds;
+	bounds[y] = DoubleInterval(0, 1);
+
+	vs::DisjunctionOfConstraintConjunctions expected;
+	carl::Variables conflicting;
+	bool applied = vs::substitute(c1, s1, expected, false, conflicting, noBounds);
+
+	vs::SubstitutionCache cache(2);
+	bool hit = true;
+	const vs::SubstitutionCache::Result& first = cache.substitute(c1, s1, false, noBounds, hit);
+	BOOST_CHECK(!hit);
+	BOOST_CHECK(first.mApplied == applied);
+	BOOST_CHECK(first.mResult == expected);
+	const vs::SubstitutionCache::Result& second = cache.substitute(c1, s1, false, noBounds, hit);
+	BOOST_CHECK(hit);
+	BOOST_CHECK(second.mResult == expected);
+
+	// The bounds on the variables of the constraint and the term are part of the key.
+	cache.substitute(c1, s1, false, bounds, hit);
+	BOOST_CHECK(!hit);
+	BOOST_CHECK_EQUAL(cache.size(), 2);
+
+	// The oldest result is dropped, if the cache is full.
+	cache.substitute(c2, s1, false, noBounds, hit);
+	BOOST_CHECK(!hit);
+	BOOST_CHECK_EQUAL(cache.size(), 2);
+	cache.substitute(c1, s1, false, noBounds, hit);
+	BOOST_CHECK(!hit);
+
+	// Prefetched results are stored, duplicate jobs are computed once.
+	cache.clear();
+	std::vector<std::pair<ConstraintT,const vs::Substitution*>> jobs = { {c1, &s1}, {c1, &s2}, {c1, &s1} };
+	BOOST_CHECK_EQUAL(cache.prefetch(jobs, false, noBounds, 2), 2);
+	const vs::SubstitutionCache::Result& prefetched = cache.substitute(c1, s1, false, noBounds, hit);
+	BOOST_CHECK(hit);
+	BOOST_CHECK(prefetched.mResult == expected);
+	cache.substitute(c1, s2, false, noBounds, hit);
+	BOOST_CHECK(hit);
+	BOOST_CHECK_EQUAL(cache.prefetch(jobs, false, noBounds, 2), 0);
+}
+
+BOOST_AUTO_TEST_CASE(FreeList)
+{
+	struct Chunk { double mValue; char mTag; };
+	auto& pool = vs::FreeList<Chunk>::instance();
+	BOOST_CHECK(&pool == &vs::FreeList<Chunk>::instance());
+
+	// More chunks than fit into the first block, all of them distinct and aligned.
+	std::set<void*> chunks;
+	for (std::size_t i = 0; i < 1000; ++i) {
+		void* chunk = pool.allocate();
+		BOOST_CHECK(reinterpret_cast<std::uintptr_t>(chunk) % alignof(Chunk) == 0);
+		static_cast<Chunk*>(chunk)->mValue = (double)i;
+		chunks.insert(chunk);
+	}
+	BOOST_CHECK_EQUAL(chunks.size(), 1000);
+
+	// Deleted chunks are reused before new ones are taken from a block.
+	void* last = *chunks.begin();
+	pool.deallocate(last);
+	BOOST_CHECK(pool.allocate() == last);
+	for (void* chunk: chunks) pool.deallocate(chunk);
+	std::set<void*> reused;
+	for (std::size_t i = 0; i < 1000; ++i) reused.insert(pool.allocate());
+	BOOST_CHECK(reused == chunks);
+	for (void* chunk: reused) pool.deallocate(chunk);
+
+	// The nodes of lists are taken from the pool.
+	std::list<int, vs::FreeListAllocator<int>> list;
+	for (int i = 0; i < 1000; ++i) list.push_back(i);
+	list.remove_if([](int i){ return i % 2 == 0; });
+	for (int i = 0; i < 10; ++i) list.push_front(-i);
+	BOOST_CHECK_EQUAL(list.size(), 510);
+	BOOST_CHECK_EQUAL(list.front(), -9);
+	BOOST_CHECK_EQUAL(list.back(), 999);
+}
+
+BOOST_AUTO_TEST_SUITE_END();
@@ -0,0 +1,2 @@
+#define BOOST_TEST_MODULE test_modules
+#include <boost/test/unit_test.hpp>